@@ -33,46 +33,57 @@
 #include <string>
 #include "Utility.h"
 #include "CommandQueue.h"
-#include "SoundNode.h"
+#include "ExplosionPool.h"
+#include "BehaviourScheduler.h"
+#include <algorithm>
 #include <functional>
+#include <cassert>
 
 
 using namespace std::placeholders;
 
 namespace GEX {
 
-	namespace
-	{
-		const std::map<AircraftType, AircraftData>	TABLE = initializeAircraftData();
-	}
-
-	Aircraft::Aircraft(AircraftType type, const TextureManager & textures)
-		: Entity(TABLE.at(type).hitPoints)
+	Aircraft::Aircraft(AircraftType type, const TextureManager & textures, const GameData& data,
+						ExplosionPool& explosions, TextBatch& labels, TimerWheel& timers,
+						const ParticleRegistry& particleSystems, GameplayEventBus& events)
+		: Entity(data.aircraft.at(type).hitPoints)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
-		, explosion_(textures.get(TextureID::Explosion))
+		, data_(data)
+		, sprite_(*textures.get(data.aircraft.at(type).texture).texture,
+			textures.get(data.aircraft.at(type).texture).map(data.aircraft.at(type).textureRect))
+		, textureRect_(sprite_.getTextureRect())
+		, explosions_(explosions)
+		, explosion_(nullptr)
 		, showExplosion_(true)
-		, healthDisplay_(nullptr)
-		, missileDisplay_(nullptr)
-		, travelDistance_(0.f)
-		, directionIndex_(0)
+		, healthDisplay_()
+		, missileDisplay_()
+		, displayedHitPoints_(data.aircraft.at(type).hitPoints)
+		, behaviours_(nullptr)
+		, behaviourId_(0)
+		, behaviourStep_(0)
+		, burstShotsLeft_(0)
+		, firesAtWill_(false)
 		, isFiring_(false)
 		, fireRateLevel_(1)
 		, fireSpreadLevel_(1)
-		, fireCountdown_(sf::Time::Zero)
+		, timers_(timers)
+		, particleSystems_(particleSystems)
+		, events_(events)
+		, fireCooldown_(TimerWheel::NoTimer)
 		, fireCommand_()
 		, launchMissileCommand_()
 		, isLaunchingMissile_(false)
 		, isMarkedForRemoval_(false)
 		, spawnPickup_(false)
 		, isRollAnimation_(false)
-		, hasPlayedExplosionSound_(false)
 	{
-		explosion_.setFrameSize(sf::Vector2f(256, 256));
-		explosion_.setNumFrames(16);
-		explosion_.setDuration(sf::seconds(1));
-
-		centerOrigin(explosion_);
+		//enemies fire whenever the cooldown allows, unless their script decides when
+		const BehaviourScript& behaviour = data.aircraft.at(type).behaviour;
+		firesAtWill_ = !isAllied() && std::none_of(behaviour.begin(), behaviour.end(),
+			[](const BehaviourStep& step) { return step.type == BehaviourStep::Type::FireBurst; });
+		if (firesAtWill_)
+			fireBullet();
 
 		// Set up commands
 		fireCommand_.category = Category::AirSceneLayer;
@@ -96,16 +107,31 @@ namespace GEX {
 
 		centerOrigin(sprite_);
 
-		std::unique_ptr<TextNode> health(new TextNode(""));
+		std::unique_ptr<TextNode> health(new TextNode(std::to_string(displayedHitPoints_) + "HP", labels));
+		health->setPosition(0.f, 50.f);
 
-		healthDisplay_ = health.get();
+		healthDisplay_ = health->getHandle();
 		attachChild(std::move(health));
 	}
 
+	Aircraft::~Aircraft()
+	{
+		if (explosion_)
+			explosions_.release(explosion_);
+
+		if (behaviours_)
+			behaviours_->remove(behaviourId_);
+
+		timers_.cancel(fireCooldown_);
+	}
+
 	void Aircraft::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
 	{
 		if (isDestroyed() && showExplosion_)
-			target.draw(explosion_, states);
+		{
+			if (explosion_)
+				target.draw(*explosion_, states);
+		}
 		else
 			target.draw(sprite_, states);
 	}
@@ -125,14 +151,22 @@ namespace GEX {
 	}
 	void Aircraft::updateText()
 	{
-		healthDisplay_->setText(std::to_string(getHitPoints()) + "HP");
-		healthDisplay_->setPosition(0.f, 50.f);
+		TextNode* healthDisplay = resolve<TextNode>(healthDisplay_);
+		if (!healthDisplay)
+			return;
 
-		healthDisplay_->setRotation(-getRotation());
+		//only rebuild the label when the value changes
+		if (displayedHitPoints_ != getHitPoints())
+		{
+			displayedHitPoints_ = getHitPoints();
+			healthDisplay->setText(std::to_string(displayedHitPoints_) + "HP");
+		}
+
+		healthDisplay->setRotation(-getRotation());
 	}
 	void Aircraft::fireBullet()
 	{
-		if (TABLE.at(type_).fireInterval != sf::Time::Zero)
+		if (data_.aircraft.at(type_).fireInterval != sf::Time::Zero)
 			isFiring_ = true;
 	}
 	void Aircraft::launchMissile()
@@ -143,15 +177,6 @@ namespace GEX {
 	{
 		return (type_ == AircraftType::Eagle);
 	}
-	void Aircraft::playLocalSound(CommandQueue & commands, SoundEffectID effect)
-	{
-		Command playSoundCommand;
-		playSoundCommand.category = Category::Type::SoundEffect;
-		playSoundCommand.action = derivedAction<SoundNode>(
-			std::bind(&SoundNode::playSound, _1, effect, getWorldPosition())
-			);
-		commands.push(playSoundCommand);
-	}
 	void Aircraft::increaseFireRate()
 	{
 		if (fireRateLevel_ < 10)
@@ -166,13 +191,13 @@ namespace GEX {
 	{
 		missileAmmo_ += count;
 	}
-	sf::FloatRect Aircraft::getBoundingBox() const
+	sf::FloatRect Aircraft::getLocalBounds() const
 	{
-		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
+		return sprite_.getGlobalBounds();
 	}
 	bool Aircraft::isMarkedForRemoval() const
 	{
-		return (isDestroyed() && (explosion_.isFinished() || !showExplosion_));
+		return (isDestroyed() && (!showExplosion_ || (explosion_ && explosion_->isFinished())));
 	}
 	void Aircraft::remove()
 	{
@@ -181,9 +206,9 @@ namespace GEX {
 	}
 	void Aircraft::updateRollAnimation()
 	{
-		if (TABLE.at(type_).hasRollAnimation)
+		if (data_.aircraft.at(type_).hasRollAnimation)
 		{
-			sf::IntRect textureRect = TABLE.at(type_).textureRect;
+			sf::IntRect textureRect = textureRect_;
 
 			//Roll left
 			if (getVelocity().x < 0.f)
@@ -199,6 +224,44 @@ namespace GEX {
 			sprite_.setTextureRect(textureRect);
 		}
 	}
+	void Aircraft::save(Snapshot & snapshot) const
+	{
+		Entity::save(snapshot);
+		snapshot.type = type_;
+		snapshot.behaviourStep = behaviourStep_;
+		snapshot.burstShotsLeft = burstShotsLeft_;
+		snapshot.behaviourWait = behaviours_ ? behaviours_->getTimeUntilWake(behaviourId_) : sf::Time::Zero;
+		snapshot.isFiring = isFiring_;
+		snapshot.isLaunchingMissile = isLaunchingMissile_;
+		snapshot.fireRateLevel = fireRateLevel_;
+		snapshot.fireSpreadLevel = fireSpreadLevel_;
+		snapshot.fireCountdown = timers_.getRemaining(fireCooldown_);
+		snapshot.missileAmmo = missileAmmo_;
+		snapshot.spawnPickup = spawnPickup_;
+	}
+
+	void Aircraft::restore(const Snapshot & snapshot)
+	{
+		assert(snapshot.type == type_);
+
+		Entity::restore(snapshot);
+		behaviourStep_ = snapshot.behaviourStep;
+		burstShotsLeft_ = snapshot.burstShotsLeft;
+		isFiring_ = snapshot.isFiring;
+		isLaunchingMissile_ = snapshot.isLaunchingMissile;
+		fireRateLevel_ = snapshot.fireRateLevel;
+		fireSpreadLevel_ = snapshot.fireSpreadLevel;
+		timers_.cancel(fireCooldown_);
+		fireCooldown_ = TimerWheel::NoTimer;
+		if (snapshot.fireCountdown > sf::Time::Zero)
+			startFireCooldown(snapshot.fireCountdown);
+		missileAmmo_ = snapshot.missileAmmo;
+		spawnPickup_ = snapshot.spawnPickup;
+
+		updateText();
+		updateRollAnimation();
+	}
+
 	void Aircraft::updateCurrent(sf::Time dt, CommandQueue& commands)
 	{
 		checkProjectileLaunch(dt, commands);
@@ -207,42 +270,94 @@ namespace GEX {
 		if (isDestroyed())
 		{
 			checkPickupDrop(commands);
-			explosion_.update(dt);
-			if (!hasPlayedExplosionSound_)
+
+			if (showExplosion_)
 			{
-				hasPlayedExplosionSound_ = true;
-				SoundEffectID effect = (randomInt(2) == 0 ? SoundEffectID::Explosion1 : SoundEffectID::Explosion2);
-				playLocalSound(commands, effect);
+				if (!explosion_)
+					explosion_ = explosions_.acquire();
+				explosion_->update(dt);
 			}
 			return;
 		}
-		updateMovementPattern(dt);
 		Entity::updateCurrent(dt, commands);
 		updateRollAnimation();
 		updateText();
 		
 	}
-	void Aircraft::updateMovementPattern(sf::Time dt)
+	void Aircraft::startFireCooldown(sf::Time duration)
 	{
-		//movement pattern
-		const std::vector<Direction>& directions = TABLE.at(type_).directions;
+		fireCooldown_ = timers_.schedule(duration, [this]()
+		{
+			fireCooldown_ = TimerWheel::NoTimer;
+			if (firesAtWill_)
+				fireBullet();
+		});
+	}
+
+	void Aircraft::attachBehaviour(BehaviourScheduler & scheduler, sf::Time delay)
+	{
+		assert(!behaviours_);
+
+		if (data_.aircraft.at(type_).behaviour.empty())
+			return;
+
+		behaviours_ = &scheduler;
+		behaviourId_ = scheduler.add(*this, delay);
+	}
+
+	bool Aircraft::resumeBehaviour(sf::Time & wait)
+	{
+		const BehaviourScript& script = data_.aircraft.at(type_).behaviour;
+
+		if (isDestroyed())
+			return false;
 
-		if (!directions.empty())
+		//steps that take no time run back to back, a whole pass without waiting ends the script
+		for (std::size_t passed = 0; passed <= script.size() && behaviourStep_ < script.size(); ++passed)
 		{
-			if (travelDistance_ > (directions[directionIndex_].distance))
+			const BehaviourStep& step = script[behaviourStep_];
+
+			switch (step.type)
 			{
-				directionIndex_ = (++directionIndex_) % directions.size();
-				travelDistance_ = 0;
+			case BehaviourStep::Type::Wait:
+				++behaviourStep_;
+				wait = step.duration;
+				return true;
+
+			case BehaviourStep::Type::Move:
+				steer(step.direction * getMaxSpeed());
+				++behaviourStep_;
+				wait = getMaxSpeed() > 0.f ? sf::seconds(step.distance / getMaxSpeed()) : sf::Time::Zero;
+				return true;
+
+			case BehaviourStep::Type::FireBurst:
+				if (burstShotsLeft_ == 0)
+					burstShotsLeft_ = step.shots;
+
+				fireBullet();
+				if (--burstShotsLeft_ == 0)
+					++behaviourStep_;
+				wait = step.duration;
+				return true;
+
+			case BehaviourStep::Type::Repeat:
+				behaviourStep_ = 0;
+				break;
 			}
-			float radians = toRadian(directions[directionIndex_].angle + 90.f);
-			float vx = getMaxSpeed() * std::cos(radians);
-			float vy = getMaxSpeed() * std::sin(radians);
+		}
 
-			setVelocity(vx, vy);
-			travelDistance_ += getMaxSpeed() * dt.asSeconds();
+		return false;
+	}
 
-		}
+	void Aircraft::steer(sf::Vector2f velocity)
+	{
+		//wakes run on the World's clock, but an enemy outside the activity band still owes
+		//the ticks it skipped and will move through them at the new velocity. Settle that
+		//time at the old velocity so the turn lands where it would have at full rate
+		move((getVelocity() - velocity) * getOwedTime().asSeconds());
+		setVelocity(velocity);
 	}
+
 	void Aircraft::checkPickupDrop(CommandQueue & commands)
 	{
 		if (!isAllied() && randomInt(1) == 0 && !spawnPickup_)
@@ -256,7 +371,7 @@ namespace GEX {
 	{
 		auto type = static_cast<Pickup::Type>(randomInt(static_cast<int>(Pickup::Type::Count)));
 
-		std::unique_ptr<Pickup> pickup(new Pickup(type, textures));
+		std::unique_ptr<Pickup> pickup(new Pickup(type, textures, data_));
 		pickup->setPosition(getWorldPosition());
 		pickup->setVelocity(0.f, 0.f);
 		node.attachChild(std::move(pickup));
@@ -264,7 +379,7 @@ namespace GEX {
 
 	float Aircraft::getMaxSpeed() const
 	{
-		return TABLE.at(type_).speed;
+		return data_.aircraft.at(type_).speed;
 	}
 
 	void Aircraft::createBullets(SceneNode & node, const TextureManager & textures)
@@ -290,7 +405,7 @@ namespace GEX {
 	void Aircraft::createProjectile(SceneNode & node, Projectile::Type type, float xOffset, float yOffset, 
 									const TextureManager & texture)
 	{
-		std::unique_ptr<Projectile> projectile(new Projectile(type, texture));
+		std::unique_ptr<Projectile> projectile(new Projectile(type, texture, data_, particleSystems_));
 		sf::Vector2f offset(xOffset * sprite_.getGlobalBounds().width, yOffset * sprite_.getGlobalBounds().height);
 		sf::Vector2f velocity(0.f, projectile->getMaxSpeed());
 		float sign = isAllied() ? -1.f : 1.f;
@@ -302,30 +417,23 @@ namespace GEX {
 
 	}
 
-	void Aircraft::checkProjectileLaunch(sf::Time dt, CommandQueue & commands)
+	void Aircraft::checkProjectileLaunch(sf::Time, CommandQueue & commands)
 	{
-		//enemies are always firing
-		if (!isAllied())
-			fireBullet();
-
-		if (isFiring_ && fireCountdown_ <= sf::Time::Zero)
+		if (isFiring_ && fireCooldown_ == TimerWheel::NoTimer)
 		{
 			commands.push(fireCommand_);
-			playLocalSound(commands, isAllied() ? SoundEffectID::AlliedGunFire : SoundEffectID::EnemyGunFire);
-			fireCountdown_ += TABLE.at(type_).fireInterval / (fireRateLevel_ + 1.f);
+			Projectile::Type bullet = isAllied() ? Projectile::Type::AlliedBullet : Projectile::Type::EnemyBullet;
+			events_.publish({ GameplayEvent::Type::ShotFired, getCategory(), getWorldPosition(), static_cast<int>(bullet) });
+			startFireCooldown(data_.aircraft.at(type_).fireInterval / (fireRateLevel_ + 1.f));
 			isFiring_ = false;
 		}
-		else if(fireCountdown_ > sf::Time::Zero)
-		{
-			fireCountdown_ -= dt;
-		}
 
 		//missile
 		if (isLaunchingMissile_)
 		{
 			commands.push(launchMissileCommand_);
-
-			playLocalSound(commands, SoundEffectID::LaunchMissile);
+			events_.publish({ GameplayEvent::Type::ShotFired, getCategory(), getWorldPosition(),
+				static_cast<int>(Projectile::Type::Missile) });
 			isLaunchingMissile_ = false;
 		}
 	}
@@ -29,15 +29,22 @@
 
 #pragma once
 #include "Entity.h"
+#include "TimerWheel.h"
 #include <SFML/Graphics/Sprite.hpp>
 #include "TextureManager.h"
 #include "Command.h"
 #include "Projectile.h"
+#include "GameplayEventBus.h"
 
 
 namespace GEX{
 
 	class TextNode;
+	struct GameData;
+	class ExplosionPool;
+	class TextBatch;
+	class BehaviourScheduler;
+	class ParticleRegistry;
 
 	enum class AircraftType {   //enumeration of aircraft types
 		Eagle,
@@ -48,7 +55,26 @@ namespace GEX{
 	class Aircraft : public Entity
 	{
 	public:
-								Aircraft(AircraftType type, const TextureManager& textures);
+		struct Snapshot : Entity::Snapshot
+		{
+			AircraftType		type;
+			std::size_t			behaviourStep;
+			int					burstShotsLeft;
+			sf::Time			behaviourWait;		//until the script resumes
+			bool				isFiring;
+			bool				isLaunchingMissile;
+			int					fireRateLevel;
+			int					fireSpreadLevel;
+			sf::Time			fireCountdown;
+			int					missileAmmo;
+			bool				spawnPickup;
+		};
+
+	public:
+								Aircraft(AircraftType type, const TextureManager& textures, const GameData& data,
+										ExplosionPool& explosions, TextBatch& labels, TimerWheel& timers,
+										const ParticleRegistry& particleSystems, GameplayEventBus& events);
+								~Aircraft();
 
 								//draw sprite
 		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
@@ -62,22 +88,25 @@ namespace GEX{
 		void					launchMissile();
 		bool					isAllied() const;
 
-		void					playLocalSound(CommandQueue &commands, SoundEffectID effect);
-
 		void					increaseFireRate();
 		void					increaseFireSpread();
 		void					collectMissiles(unsigned int count);
-		sf::FloatRect			getBoundingBox() const override;
 		bool					isMarkedForRemoval() const override;
 		void					remove() override;
 		void					updateRollAnimation();
+
+		void					save(Snapshot& snapshot) const;
+		void					restore(const Snapshot& snapshot);	//type must match, attach the behaviour after
+
+		void					attachBehaviour(BehaviourScheduler& scheduler, sf::Time delay = sf::Time::Zero);	//no-op without a script
+		bool					resumeBehaviour(sf::Time& wait);	//called by the scheduler, false once the script is over
 		
 
 	protected:
 		void					updateCurrent(sf::Time dt, CommandQueue& comands) override;
+		sf::FloatRect			getLocalBounds() const override;
 
 	private:
-		void					updateMovementPattern(sf::Time dt);
 		void					checkPickupDrop(CommandQueue& commands);
 
 		void					createPickup(SceneNode& node, const TextureManager& textures) const;
@@ -86,32 +115,43 @@ namespace GEX{
 		void					createProjectile(SceneNode& node, Projectile::Type type, float xOffset, float yOffset,
 												const TextureManager& texture);
 		void					checkProjectileLaunch(sf::Time dt, CommandQueue& commands);
+		void					startFireCooldown(sf::Time duration);
+		void					steer(sf::Vector2f velocity);	//from a script, keeps reduced-rate movement in step
 
 	private:
 
+		const GameData&			data_;
 		sf::Sprite				sprite_;
+		sf::IntRect				textureRect_;	//unrolled frame, in atlas coordinates
 		AircraftType			type_;
-		TextNode*				healthDisplay_;
-		TextNode*				missileDisplay_;
-		Animation				explosion_;
+		Handle					healthDisplay_;
+		Handle					missileDisplay_;
+		int						displayedHitPoints_;	//value currently shown by healthDisplay_
+		ExplosionPool&			explosions_;
+		Animation*				explosion_;		//borrowed from explosions_ once destroyed
 		bool					showExplosion_;
 
-		float					travelDistance_;
-		std::size_t				directionIndex_;
+		BehaviourScheduler*		behaviours_;	//null until a script is attached
+		std::size_t				behaviourId_;
+		std::size_t				behaviourStep_;
+		int						burstShotsLeft_;
+		bool					firesAtWill_;	//enemies without scripted bursts keep the trigger held
 
 		bool					isFiring_;
 		bool					isLaunchingMissile_;
 		bool					isMarkedForRemoval_;
 		int						fireRateLevel_;
 		int						fireSpreadLevel_;
-		sf::Time				fireCountdown_;
+		TimerWheel&				timers_;
+		const ParticleRegistry&	particleSystems_;	//for missile trails
+		GameplayEventBus&		events_;
+		TimerWheel::Id			fireCooldown_;	//NoTimer when ready to fire
 		Command					fireCommand_;
 		Command					launchMissileCommand_;
 		Command					dropPickupCommand_;
 		int						missileAmmo_;
 		bool					spawnPickup_;
 		bool					isRollAnimation_;
-		bool					hasPlayedExplosionSound_;
 	};
 }
 
@@ -0,0 +1,91 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace GEX {
+
+#ifdef GEX_COUNT_ALLOCATIONS
+
+	namespace
+	{
+		std::atomic<std::size_t> allocationCount(0);
+	}
+
+	bool isCountingAllocations()
+	{
+		return true;
+	}
+
+	std::size_t getAllocationCount()
+	{
+		return allocationCount.load(std::memory_order_relaxed);
+	}
+}
+
+//the array, nothrow and sized forms all forward to these two
+void* operator new(std::size_t size)
+{
+	GEX::allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	//same contract as the standard one, the new_handler gets to free memory before giving up
+	for (;;)
+	{
+		if (void* memory = std::malloc(size ? size : 1))
+			return memory;
+
+		std::new_handler handler = std::get_new_handler();
+		if (!handler)
+			throw std::bad_alloc();
+		handler();
+	}
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+#else
+
+	bool isCountingAllocations()
+	{
+		return false;
+	}
+
+	std::size_t getAllocationCount()
+	{
+		return 0;
+	}
+}
+
+#endif
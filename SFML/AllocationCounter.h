@@ -27,25 +27,15 @@
 * NBCC Academic Integrity Policy (policy 1111)
 */
 
-#include "SoundNode.h"
+#pragma once
+#include <cstddef>
 
 namespace GEX {
 
+	//global operator new is only replaced when GEX_COUNT_ALLOCATIONS is defined, for benchmark builds,
+	//everything else keeps the standard allocator and always reports 0
+	bool					isCountingAllocations();
 
-	SoundNode::SoundNode(SoundPlayer & player)
-		: SceneNode()
-		, sounds_(player)
-	{
-	}
-
-
-	void SoundNode::playSound(SoundEffectID sound, sf::Vector2f position)
-	{
-		sounds_.play(sound, position);
-	}
-
-	unsigned int SoundNode::getCategory() const
-	{
-		return Category::Type::SoundEffect;
-	}
-}
\ No newline at end of file
+	//number of global operator new calls since startup, from every thread
+	std::size_t				getAllocationCount();
+}
@@ -29,12 +29,14 @@
 
 #include "Animation.h"
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
 
 namespace GEX {
 
 	Animation::Animation()
 		: sprite_()
 		, frameSize_()
+		, frames_(nullptr)
 		, numberOfFrames_(0)
 		, currentFrame_(0)
 		, duration_(sf::Time::Zero)
@@ -46,6 +48,7 @@ namespace GEX {
 	Animation::Animation(const sf::Texture & texture)
 		: sprite_(texture)
 		, frameSize_()
+		, frames_(nullptr)
 		, numberOfFrames_(0)
 		, currentFrame_(0)
 		, duration_(sf::Time::Zero)
@@ -74,6 +77,15 @@ namespace GEX {
 		return frameSize_;
 	}
 
+	void Animation::setFrames(const std::vector<sf::IntRect>& frames)
+	{
+		frames_ = &frames;
+		numberOfFrames_ = frames.size();
+
+		if (!frames.empty())
+			frameSize_ = sf::Vector2f(static_cast<float>(frames.front().width), static_cast<float>(frames.front().height));
+	}
+
 	void Animation::setNumFrames(size_t numFrames)
 	{
 		numberOfFrames_ = numFrames;
@@ -107,6 +119,10 @@ namespace GEX {
 	void Animation::restart()
 	{
 		currentFrame_ = 0;
+		elapsedTime_ = sf::Time::Zero;
+
+		if (numberOfFrames_ > 0)
+			sprite_.setTextureRect(getFrameRect(0));
 	}
 
 	bool Animation::isFinished() const
@@ -126,41 +142,34 @@ namespace GEX {
 
 	void Animation::update(sf::Time dt)
 	{
-		sf::Time timePerFrame = duration_ / static_cast<float>(numberOfFrames_);
+		if (numberOfFrames_ == 0 || duration_ <= sf::Time::Zero)
+			return;
+
 		elapsedTime_ += dt;
 
-		sf::Vector2f textureBounds(sprite_.getTexture()->getSize());
-		sf::IntRect textureRect = sprite_.getTextureRect();
-
-		if (currentFrame_ == 0)
-			textureRect = sf::IntRect(0, 0, frameSize_.x, frameSize_.y);
-
-		while (elapsedTime_ >= timePerFrame && (currentFrame_ <= numberOfFrames_ || repeat_))
-		{
-			//move to next frame
-			textureRect.left += textureRect.width;
-
-			//go to next row if needed
-			if (textureRect.left + textureRect.width > textureBounds.x)
-			{
-				textureRect.left = 0;
-				textureRect.top += textureRect.height;
-			}
-
-			elapsedTime_ -= timePerFrame;
-
-			if (repeat_)
-			{
-				currentFrame_ = (currentFrame_ + 1) % numberOfFrames_;
-				if (currentFrame_ == 0)
-					textureRect = sf::IntRect(0, 0, frameSize_.x, frameSize_.y);
-			}
-			else
-			{
-				currentFrame_++;
-			}
-		}
-		sprite_.setTextureRect(textureRect);
+		if (repeat_)
+			elapsedTime_ = elapsedTime_ % duration_;
+
+		//frame index straight from elapsed time, no stepping
+		sf::Int64 timePerFrame = std::max<sf::Int64>(duration_.asMicroseconds() / numberOfFrames_, 1);
+		std::size_t frame = static_cast<std::size_t>(elapsedTime_.asMicroseconds() / timePerFrame);
+
+		currentFrame_ = repeat_ ? frame % numberOfFrames_ : std::min(frame, numberOfFrames_);
+
+		if (currentFrame_ < numberOfFrames_)
+			sprite_.setTextureRect(getFrameRect(currentFrame_));
+	}
+
+	sf::IntRect Animation::getFrameRect(std::size_t frame) const
+	{
+		if (frames_)
+			return (*frames_)[frame];
+
+		//frames laid out left to right, top to bottom
+		sf::Vector2i size(frameSize_);
+		std::size_t columns = std::max<std::size_t>(sprite_.getTexture()->getSize().x / std::max(size.x, 1), 1);
+
+		return sf::IntRect(static_cast<int>(frame % columns) * size.x, static_cast<int>(frame / columns) * size.y, size.x, size.y);
 	}
 
 	void Animation::draw(sf::RenderTarget & target, sf::RenderStates states) const
@@ -33,6 +33,7 @@
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/System/Time.hpp>
+#include <vector>
 
 
 namespace GEX {
@@ -48,6 +49,8 @@ namespace GEX {
 		void								setFrameSize(sf::Vector2f frameSize);
 		sf::Vector2f						getFrameSize() const;
 
+		void								setFrames(const std::vector<sf::IntRect>& frames); //shared, pre-computed frame rects
+
 		void								setNumFrames(std::size_t numFrames);
 		std::size_t							getNumFrames() const;
 
@@ -67,12 +70,15 @@ namespace GEX {
 
 
 	private:
+		sf::IntRect							getFrameRect(std::size_t frame) const;
+
 											//overriding draw in sf::Drawable
 		void								draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 	private:
 		sf::Sprite							sprite_;
 		sf::Vector2f						frameSize_;
+		const std::vector<sf::IntRect>*		frames_;
 		std::size_t							numberOfFrames_;
 		std::size_t							currentFrame_;
 		sf::Time							duration_;
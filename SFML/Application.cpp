@@ -37,13 +37,15 @@
 #include "GameOverState.h"
 #include "FontManager.h"
 
-const sf::Time Application::timePerFrame = sf::seconds(1.0f / 60.0f);	//seconds per frame for 60 fps
-
-Application::Application()
+Application::Application(unsigned int ticksPerSecond, unsigned int maxStepsPerFrame)
 	: window_(sf::VideoMode(1024, 768), "Killer Planes")
 	, player_()
 	, textures_()
-	, stateStack_(GEX::State::Context(window_, textures_, player_, music_, sound_))
+	, renderTargets_()
+	, quality_()
+	, threads_()
+	, timestep_(ticksPerSecond, maxStepsPerFrame)
+	, stateStack_(GEX::State::Context(window_, textures_, player_, music_, sound_, renderTargets_, quality_, threads_, timestep_))
 	, statisticsText_()
 	, statisticsUpdateTime_()
 	, statisticsNumFrames_(0)
@@ -53,8 +55,9 @@ Application::Application()
 	GEX::FontManager::getInstance().load(GEX::FontID::Main, "Media/Sansation.ttf");
 
 
-	textures_.load(GEX::TextureID::TitleScreen, "Media/Textures/TitleScreen.png");
-	textures_.load(GEX::TextureID::Face, "Media/Textures/face.png");
+	textures_.loadToAtlas(GEX::TextureID::TitleScreen, "Media/Textures/TitleScreen.png");
+	textures_.loadToAtlas(GEX::TextureID::Face, "Media/Textures/face.png");
+	textures_.packAtlas();
 
 	statisticsText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
 	statisticsText_.setPosition(0.0f, 0.0f);
@@ -68,26 +71,25 @@ Application::Application()
 void Application::run()
 {
 	sf::Clock clock;
-	sf::Time timeSinceLastUpdate = sf::Time::Zero;
 
 	while (window_.isOpen())
 	{
-		timeSinceLastUpdate += clock.restart(); //not adding, now reseting
+		sf::Time frameTime = clock.restart();
+		timestep_.addFrameTime(frameTime);
+		quality_.addFrame(frameTime);
 
-		while (timeSinceLastUpdate > timePerFrame)
+		while (timestep_.step())
 		{
 			processInput();
-			update(timePerFrame);
+			update(timestep_.getTickTime());
 
 			if (stateStack_.isEmpty())
 			{
 				window_.close();
 			}
-			timeSinceLastUpdate -= timePerFrame;
-			
 		}
-		updateStatistics(timeSinceLastUpdate);
-		render();
+		updateStatistics(frameTime);
+		render();	//states interpolate with timestep_.getAlpha()
 	}
 }
 
@@ -37,11 +37,16 @@
 #include <SFML/Graphics/Font.hpp>
 #include "CommandQueue.h"
 #include "SoundPlayer.h"
+#include "RenderTargetPool.h"
+#include "QualityGovernor.h"
+#include "ThreadPool.h"
+#include "FixedTimestep.h"
 
 class Application
 {
 public:
-						Application();
+						//simulation rate, independent of the display rate, and how many ticks a slow frame may catch up
+	explicit			Application(unsigned int ticksPerSecond = 60, unsigned int maxStepsPerFrame = 5);
 
 						//game loop
 	void				run();
@@ -60,11 +65,14 @@ private:
 	void				registerStates();
 
 private:
-	static const sf::Time timePerFrame;
 	sf::RenderWindow	  window_;
 
 	GEX::PlayerControl    player_;
 	GEX::TextureManager   textures_;
+	GEX::RenderTargetPool renderTargets_;	//post-processing targets shared by every World
+	GEX::QualityGovernor  quality_;		//fed real frame times, read by GameState
+	GEX::ThreadPool		  threads_;		//workers for data parallel jobs
+	GEX::FixedTimestep	  timestep_;	//simulation ticks and render interpolation
 	GEX::StateStack		  stateStack_;
 	GEX::MusicPlayer      music_;
 	GEX::SoundPlayer      sound_;
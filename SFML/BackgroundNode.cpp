@@ -0,0 +1,121 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "BackgroundNode.h"
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <cmath>
+
+namespace GEX {
+
+	BackgroundNode::BackgroundNode(const sf::Texture & texture, float width, float chunkHeight)
+		: SceneNode()
+		, texture_(texture)
+		, width_(width)
+		, chunkHeight_(chunkHeight)
+		, chunks_()
+		, vertices_(sf::Quads)
+	{
+	}
+
+	void BackgroundNode::setViewBounds(const sf::FloatRect & bounds)
+	{
+		//one chunk of look ahead above the view so new chunks never pop in
+		int first = static_cast<int>(std::floor((bounds.top - getPosition().y) / chunkHeight_)) - 1;
+		int last = static_cast<int>(std::floor((bounds.top + bounds.height - getPosition().y) / chunkHeight_));
+
+		bool changed = false;
+
+		//jumped too far to reuse anything
+		if (!chunks_.empty() && (chunks_.front() > last || chunks_.back() < first))
+		{
+			chunks_.clear();
+		}
+
+		//recycle chunks that scrolled out of the view
+		while (!chunks_.empty() && chunks_.back() > last)
+		{
+			chunks_.pop_back();
+			changed = true;
+		}
+		while (!chunks_.empty() && chunks_.front() < first)
+		{
+			chunks_.pop_front();
+			changed = true;
+		}
+
+		if (chunks_.empty())
+		{
+			chunks_.push_back(last);
+			changed = true;
+		}
+
+		//create the chunks coming into view
+		while (chunks_.front() > first)
+		{
+			chunks_.push_front(chunks_.front() - 1);
+			changed = true;
+		}
+		while (chunks_.back() < last)
+		{
+			chunks_.push_back(chunks_.back() + 1);
+			changed = true;
+		}
+
+		if (changed)
+			buildVertices();
+	}
+
+	void BackgroundNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	{
+		states.texture = &texture_;
+		target.draw(vertices_, states);
+	}
+
+	void BackgroundNode::buildVertices()
+	{
+		vertices_.clear();
+
+		//texture repeats, so keep texture coords small to stay precise far from the origin
+		float textureHeight = static_cast<float>(texture_.getSize().y);
+
+		for (int chunk : chunks_)
+		{
+			float top = chunk * chunkHeight_;
+			float bottom = top + chunkHeight_;
+			float v = std::fmod(top, textureHeight);
+			if (v < 0.f)
+				v += textureHeight;
+
+			vertices_.append(sf::Vertex(sf::Vector2f(0.f, top), sf::Vector2f(0.f, v)));
+			vertices_.append(sf::Vertex(sf::Vector2f(width_, top), sf::Vector2f(width_, v)));
+			vertices_.append(sf::Vertex(sf::Vector2f(width_, bottom), sf::Vector2f(width_, v + chunkHeight_)));
+			vertices_.append(sf::Vertex(sf::Vector2f(0.f, bottom), sf::Vector2f(0.f, v + chunkHeight_)));
+		}
+	}
+}
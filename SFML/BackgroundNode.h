@@ -0,0 +1,58 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "SceneNode.h"
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <deque>
+
+namespace GEX {
+
+	//repeated background made of fixed height chunks that follow the view,
+	//so its cost does not grow with the length of the level
+	class BackgroundNode : public SceneNode
+	{
+	public:
+								BackgroundNode(const sf::Texture& texture, float width, float chunkHeight = 256.f);
+
+		void					setViewBounds(const sf::FloatRect& bounds);	//create chunks ahead, recycle the ones behind
+
+	private:
+		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void					buildVertices();
+
+	private:
+		const sf::Texture&		texture_;
+		float					width_;
+		float					chunkHeight_;
+		std::deque<int>			chunks_;		//resident chunk indices, top of the screen first
+		sf::VertexArray			vertices_;
+	};
+}
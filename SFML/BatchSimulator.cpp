@@ -0,0 +1,312 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "BatchSimulator.h"
+#include "World.h"
+#include "Utility.h"
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace GEX {
+
+	namespace
+	{
+		const sf::Time		TICK = sf::seconds(1.f / 60.f);
+		const sf::Vector2f	VIEW_SIZE(1024.f, 768.f);	//same as the game window
+
+		const std::map<std::string, AircraftType> AIRCRAFT_NAMES = {
+			{ "Eagle", AircraftType::Eagle },
+			{ "Raptor", AircraftType::Raptor },
+			{ "Avenger", AircraftType::Avenger },
+		};
+
+		const std::map<std::string, Projectile::Type> PROJECTILE_NAMES = {
+			{ "AlliedBullet", Projectile::Type::AlliedBullet },
+			{ "EnemyBullet", Projectile::Type::EnemyBullet },
+			{ "Missile", Projectile::Type::Missile },
+		};
+
+		const std::map<std::string, Pickup::Type> PICKUP_NAMES = {
+			{ "HealthRefill", Pickup::Type::HealthRefill },
+			{ "MissileRefill", Pickup::Type::MissileRefill },
+		};
+
+		//table.entry.field=value, throws on anything it does not know
+		void applyOverride(GameData& data, const std::string& assignment)
+		{
+			std::istringstream in(assignment);
+			std::string table, entry, field;
+			float value;
+
+			if (!std::getline(in, table, '.') || !std::getline(in, entry, '.') ||
+				!std::getline(in, field, '=') || !(in >> value))
+			{
+				throw std::runtime_error("Bad override " + assignment);
+			}
+
+			if (table == "aircraft" && AIRCRAFT_NAMES.count(entry))
+			{
+				AircraftData& aircraft = data.aircraft.at(AIRCRAFT_NAMES.at(entry));
+				if (field == "hitPoints")			{ aircraft.hitPoints = static_cast<int>(value); return; }
+				if (field == "speed")				{ aircraft.speed = value; return; }
+				if (field == "fireInterval")		{ aircraft.fireInterval = sf::seconds(value); return; }
+			}
+			else if (table == "projectile" && PROJECTILE_NAMES.count(entry))
+			{
+				ProjectileData& projectile = data.projectiles.at(PROJECTILE_NAMES.at(entry));
+				if (field == "damage")				{ projectile.damage = static_cast<int>(value); return; }
+				if (field == "speed")				{ projectile.speed = value; return; }
+			}
+			else if (table == "pickup" && PICKUP_NAMES.count(entry))
+			{
+				PickupData& pickup = data.pickups.at(PICKUP_NAMES.at(entry));
+				if (field == "value")				{ pickup.value = static_cast<int>(value); return; }
+			}
+
+			throw std::runtime_error("Unknown override " + assignment);
+		}
+
+		//stands in for the player: weaves across the screen, fires constantly, missiles now and then
+		class ScriptedPilot
+		{
+		public:
+			explicit ScriptedPilot(unsigned int seed)
+				: weavePeriod_(2.f + (seed % 5))
+				, missileCountdown_(sf::seconds(3.f))
+				, elapsed_(sf::Time::Zero)
+			{}
+
+			void act(CommandQueue& commands, sf::Time dt)
+			{
+				elapsed_ += dt;
+				missileCountdown_ -= dt;
+
+				const float PLAYER_SPEED = 200.f;
+				float direction = std::sin(elapsed_.asSeconds() * 2.f * 3.14159265f / weavePeriod_) > 0.f ? 1.f : -1.f;
+				bool launchMissile = missileCountdown_ <= sf::Time::Zero;
+				if (launchMissile)
+					missileCountdown_ = sf::seconds(3.f);
+
+				Command command;
+				command.category = Category::Type::PlayerAircraft;
+				command.action = derivedAction<Aircraft>([=](Aircraft& aircraft, sf::Time)
+				{
+					aircraft.accelerate(direction * PLAYER_SPEED, 0.f);
+					aircraft.fireBullet();
+					if (launchMissile)
+						aircraft.launchMissile();
+				});
+
+				commands.push(command);
+			}
+
+		private:
+			float				weavePeriod_;	//seconds per left-right sweep
+			sf::Time			missileCountdown_;
+			sf::Time			elapsed_;
+		};
+	}
+
+	BatchSimulator::BatchSimulator(ThreadPool & threads, sf::Time timeLimit)
+		: threads_(threads)
+		, timeLimit_(timeLimit)
+		, runs_()
+		, results_()
+	{
+	}
+
+	void BatchSimulator::loadSweep(const std::string & path)
+	{
+		std::ifstream in(path);
+		if (!in)
+		{
+			throw std::runtime_error("Sweep load failed " + path);
+		}
+
+		std::string line;
+		for (int lineNumber = 1; std::getline(in, line); ++lineNumber)
+		{
+			line = line.substr(0, line.find('#'));
+
+			std::istringstream tokens(line);
+			std::string keyword, name;
+			unsigned int seeds = 0;
+
+			if (!(tokens >> keyword))
+				continue;
+
+			if (keyword != "run" || !(tokens >> name >> seeds) || seeds == 0)
+			{
+				throw std::runtime_error(path + "(" + std::to_string(lineNumber) + "): expected run <name> <seeds> [overrides]");
+			}
+
+			GameData data;
+			std::string assignment;
+			while (tokens >> assignment)
+			{
+				applyOverride(data, assignment);
+			}
+
+			for (unsigned int seed = 1; seed <= seeds; ++seed)
+			{
+				addRun(Run{ name, seed, data });
+			}
+		}
+	}
+
+	void BatchSimulator::addRun(const Run & run)
+	{
+		runs_.push_back(run);
+	}
+
+	void BatchSimulator::simulate()
+	{
+		//everything that touches the GPU or the disk happens here, once, before going wide
+		TextureManager textures;
+		World::prepareHeadless(textures);
+
+		results_.assign(runs_.size(), Result());
+
+		//one run per job, each run is long and independent so no finer split is needed
+		threads_.parallelFor(runs_.size(), [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				results_[i] = simulate(runs_[i], textures);
+			}
+		});
+	}
+
+	BatchSimulator::Result BatchSimulator::simulate(const Run & run, const TextureManager & textures) const
+	{
+		seedRandom(run.seed);
+
+		World world(VIEW_SIZE, textures, run.data);
+		ScriptedPilot pilot(run.seed);
+
+		sf::Time elapsed = sf::Time::Zero;
+		while (elapsed < timeLimit_ && world.hasAlivePlayer() && !world.hasPlayerReachedEnd())
+		{
+			CommandQueue& commands = world.getCommandQueue();
+			pilot.act(commands, TICK);
+			world.update(TICK, commands);
+			elapsed += TICK;
+		}
+
+		const World::Statistics& statistics = world.getStatistics();
+
+		Result result;
+		result.timeAlive = statistics.timeAlive;
+		result.reachedEnd = world.hasAlivePlayer() && world.hasPlayerReachedEnd();
+		result.damageTaken = statistics.damageTaken;
+		result.pickupsCollected = statistics.pickupsCollected;
+		result.enemiesDestroyed = statistics.enemiesDestroyed;
+		result.shotsFired = statistics.shotsFired;
+		return result;
+	}
+
+	void BatchSimulator::writeResults(const std::string & path) const
+	{
+		std::ofstream out(path);
+		out << "name,seed,time_alive,reached_end,damage_taken,pickups_collected,enemies_destroyed,shots_fired\n";
+
+		for (std::size_t i = 0; i < results_.size(); ++i)
+		{
+			const Run& run = runs_[i];
+			const Result& result = results_[i];
+
+			out << run.name << ',' << run.seed << ','
+				<< result.timeAlive.asSeconds() << ',' << (result.reachedEnd ? 1 : 0) << ','
+				<< result.damageTaken << ',' << result.pickupsCollected << ',' << result.enemiesDestroyed << ','
+				<< result.shotsFired << '\n';
+		}
+
+		if (!out)
+		{
+			throw std::runtime_error("Results write failed " + path);
+		}
+	}
+
+	void BatchSimulator::writeSummary(const std::string & path) const
+	{
+		struct Totals
+		{
+			std::size_t		runs = 0;
+			float			timeAlive = 0.f;
+			std::size_t		reachedEnd = 0;
+			float			damageTaken = 0.f;
+			float			pickupsCollected = 0.f;
+			float			enemiesDestroyed = 0.f;
+			float			shotsFired = 0.f;
+		};
+
+		//keep names in the order the sweep listed them
+		std::vector<std::string> names;
+		std::map<std::string, Totals> totals;
+
+		for (std::size_t i = 0; i < results_.size(); ++i)
+		{
+			if (!totals.count(runs_[i].name))
+				names.push_back(runs_[i].name);
+
+			Totals& total = totals[runs_[i].name];
+			const Result& result = results_[i];
+
+			++total.runs;
+			total.timeAlive += result.timeAlive.asSeconds();
+			total.reachedEnd += result.reachedEnd ? 1 : 0;
+			total.damageTaken += result.damageTaken;
+			total.pickupsCollected += result.pickupsCollected;
+			total.enemiesDestroyed += result.enemiesDestroyed;
+			total.shotsFired += result.shotsFired;
+		}
+
+		std::ofstream out(path);
+		out << "name,runs,mean_time_alive,completion_rate,mean_damage_taken,mean_pickups_collected,mean_enemies_destroyed,mean_shots_fired\n";
+
+		for (const std::string& name : names)
+		{
+			const Totals& total = totals.at(name);
+			float runs = static_cast<float>(total.runs);
+
+			out << name << ',' << total.runs << ','
+				<< total.timeAlive / runs << ',' << total.reachedEnd / runs << ','
+				<< total.damageTaken / runs << ',' << total.pickupsCollected / runs << ','
+				<< total.enemiesDestroyed / runs << ',' << total.shotsFired / runs << '\n';
+		}
+
+		if (!out)
+		{
+			throw std::runtime_error("Summary write failed " + path);
+		}
+	}
+}
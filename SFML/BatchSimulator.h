@@ -0,0 +1,80 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "DataTables.h"
+#include "ThreadPool.h"
+#include <SFML/System/Time.hpp>
+#include <string>
+#include <vector>
+
+namespace GEX {
+
+	//plays many headless Worlds with different tuning on every core and writes the outcomes to CSV
+	class BatchSimulator
+	{
+	public:
+		struct Run
+		{
+			std::string						name;		//runs with the same name are aggregated
+			unsigned int					seed;
+			GameData						data;
+		};
+
+		struct Result
+		{
+			sf::Time						timeAlive;
+			bool							reachedEnd;
+			int								damageTaken;
+			int								pickupsCollected;
+			int								enemiesDestroyed;
+			int								shotsFired;
+		};
+
+	public:
+		explicit							BatchSimulator(ThreadPool& threads, sf::Time timeLimit = sf::seconds(120.f));
+
+		//sweep file lines: run <name> <seeds> [table.entry.field=value ...], see Media/Balance/Sweep.txt
+		void								loadSweep(const std::string& path);
+		void								addRun(const Run& run);
+
+		void								simulate();		//textures must be loadable, the level is compiled if needed
+		void								writeResults(const std::string& path) const;	//one row per run
+		void								writeSummary(const std::string& path) const;	//one row per name, averaged
+
+	private:
+		Result								simulate(const Run& run, const TextureManager& textures) const;
+
+	private:
+		ThreadPool&							threads_;
+		sf::Time							timeLimit_;
+		std::vector<Run>					runs_;
+		std::vector<Result>					results_;
+	};
+}
@@ -0,0 +1,67 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "Behaviour.h"
+#include "Utility.h"
+#include <cassert>
+#include <cmath>
+
+namespace GEX {
+
+	BehaviourStep BehaviourStep::wait(sf::Time duration)
+	{
+		return { Type::Wait, sf::Vector2f(), 0.f, duration, 0 };
+	}
+
+	BehaviourStep BehaviourStep::move(float angle, float distance)
+	{
+		//trig is done here, once, not every tick
+		float radians = toRadian(angle + 90.f);
+		return { Type::Move, sf::Vector2f(std::cos(radians), std::sin(radians)), distance, sf::Time::Zero, 0 };
+	}
+
+	BehaviourStep BehaviourStep::moveBy(sf::Vector2f offset)
+	{
+		float distance = length(offset);
+		assert(distance > 0.f);
+
+		return { Type::Move, offset / distance, distance, sf::Time::Zero, 0 };
+	}
+
+	BehaviourStep BehaviourStep::fireBurst(int shots, sf::Time spacing)
+	{
+		assert(shots > 0);
+		return { Type::FireBurst, sf::Vector2f(), 0.f, spacing, shots };
+	}
+
+	BehaviourStep BehaviourStep::repeat()
+	{
+		return { Type::Repeat, sf::Vector2f(), 0.f, sf::Time::Zero, 0 };
+	}
+}
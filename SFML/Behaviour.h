@@ -0,0 +1,62 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+namespace GEX {
+
+	//one instruction of an enemy behaviour script, run by BehaviourScheduler
+	struct BehaviourStep
+	{
+		enum class Type
+		{
+			Wait,		//hold the current course
+			Move,		//fly straight at full speed
+			FireBurst,	//shots spaced apart, still limited by the aircraft's fire interval
+			Repeat		//back to the first step
+		};
+
+		static BehaviourStep				wait(sf::Time duration);
+		static BehaviourStep				move(float angle, float distance);	//angle in degrees, 0 is straight down
+		static BehaviourStep				moveBy(sf::Vector2f offset);		//one leg of a path
+		static BehaviourStep				fireBurst(int shots, sf::Time spacing);
+		static BehaviourStep				repeat();
+
+		Type								type;
+		sf::Vector2f						direction;	//unit vector, Move
+		float								distance;	//Move
+		sf::Time							duration;	//Wait, spacing for FireBurst
+		int									shots;		//FireBurst
+	};
+
+	using BehaviourScript = std::vector<BehaviourStep>;
+}
@@ -0,0 +1,117 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "BehaviourScheduler.h"
+#include "Aircraft.h"
+
+namespace GEX {
+
+	BehaviourScheduler::BehaviourScheduler()
+		: now_(sf::Time::Zero)
+		, nextId_(0)
+		, wakes_()
+		, actors_()
+		, deferred_()
+	{
+	}
+
+	BehaviourScheduler::Id BehaviourScheduler::add(Aircraft & actor, sf::Time delay)
+	{
+		Id id = nextId_++;
+		Wake wake{ now_ + delay, id };
+
+		actors_[id] = Actor{ &actor, wake.time };
+		wakes_.push(wake);
+
+		return id;
+	}
+
+	void BehaviourScheduler::remove(Id id)
+	{
+		//its wake is dropped when it comes up
+		actors_.erase(id);
+	}
+
+	sf::Time BehaviourScheduler::getTimeUntilWake(Id id) const
+	{
+		auto found = actors_.find(id);
+		if (found == actors_.end())
+			return sf::Time::Zero;
+
+		return found->second.wake - now_;
+	}
+
+	void BehaviourScheduler::update(sf::Time dt)
+	{
+		now_ += dt;
+
+		while (!wakes_.empty() && wakes_.top().time <= now_)
+		{
+			Wake wake = wakes_.top();
+			wakes_.pop();
+
+			auto found = actors_.find(wake.id);
+			if (found == actors_.end())
+				continue;
+
+			sf::Time wait;
+			if (!found->second.aircraft->resumeBehaviour(wait))
+			{
+				actors_.erase(found);
+				continue;
+			}
+
+			//measured from when it was due, not from now, so long scripts do not drift
+			wake.time += wait;
+			found->second.wake = wake.time;
+
+			if (wake.time <= now_)
+				deferred_.push_back(wake);
+			else
+				wakes_.push(wake);
+		}
+
+		for (const Wake& wake : deferred_)
+			wakes_.push(wake);
+		deferred_.clear();
+	}
+
+	std::size_t BehaviourScheduler::getActorCount() const
+	{
+		return actors_.size();
+	}
+
+	bool BehaviourScheduler::Wake::operator>(const Wake & other) const
+	{
+		//ties go to the oldest actor so the order is repeatable
+		if (time != other.time)
+			return time > other.time;
+		return id > other.id;
+	}
+}
@@ -0,0 +1,81 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/System/Time.hpp>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace GEX {
+
+	class Aircraft;
+
+	//resumes behaviour scripts only when their current wait is over, idle actors cost nothing per tick
+	class BehaviourScheduler
+	{
+	public:
+		using Id = std::size_t;
+
+	public:
+											BehaviourScheduler();
+											BehaviourScheduler(const BehaviourScheduler&) = delete;
+		BehaviourScheduler&					operator=(const BehaviourScheduler&) = delete;
+
+		Id									add(Aircraft& actor, sf::Time delay);	//first resume after delay
+		void								remove(Id id);
+		sf::Time							getTimeUntilWake(Id id) const;
+
+		void								update(sf::Time dt);	//each actor resumes at most once per update
+		std::size_t							getActorCount() const;
+
+	private:
+		struct Wake
+		{
+			bool							operator>(const Wake& other) const;
+
+			sf::Time						time;
+			Id								id;
+		};
+
+		struct Actor
+		{
+			Aircraft*						aircraft;
+			sf::Time						wake;
+		};
+
+	private:
+		sf::Time							now_;
+		Id									nextId_;		//never reused, so stale wakes are skipped
+		std::priority_queue<Wake, std::vector<Wake>, std::greater<Wake>>	wakes_;
+		std::unordered_map<Id, Actor>		actors_;
+		std::vector<Wake>					deferred_;		//due again this update, pushed once it is done
+	};
+}
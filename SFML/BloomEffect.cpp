@@ -5,11 +5,12 @@
 
 
 namespace GEX {
-	BloomEffect::BloomEffect()
-		: shaders_()
-		, brightnessTexture_()
-		, firstPassTexture_()
-		, secondPassTexture_()
+	BloomEffect::BloomEffect(RenderTargetPool& renderTargets)
+		: PostEffect(renderTargets)
+		, shaders_()
+		, blurPasses_(2)
+		, secondPassEnabled_(true)
+		, chain_(getRenderTargets())
 	{
 
 		std::unique_ptr<sf::Shader> s(new sf::Shader());
@@ -44,83 +45,100 @@ namespace GEX {
 		inserted = shaders_.insert(std::make_pair(Shaders::AddPass, std::move(s)));
 		assert(inserted.second);
 
+		buildChain();
 	}
 
 	void BloomEffect::apply(const sf::RenderTexture& input, sf::RenderTarget& output)
 	{
-		prepareTextures(input.getSize());
+		chain_.apply(input, output);
+	}
+
+	void BloomEffect::setBlurPasses(std::size_t passes)
+	{
+		blurPasses_ = passes;
+		buildChain();
+	}
+
+	void BloomEffect::setSecondPassEnabled(bool flag)
+	{
+		secondPassEnabled_ = flag;
+		buildChain();
+	}
 
-		filterBright(input, brightnessTexture_);
+	void BloomEffect::buildChain()
+	{
+		using Chain = PostEffectChain;
+		using Inputs = Chain::Inputs;
 
-		downSample(brightnessTexture_, firstPassTexture_[0]);
-		blurMultipass(firstPassTexture_);
+		chain_.clear();
 
-		downSample(firstPassTexture_[0], secondPassTexture_[0]);
-		blurMultipass(secondPassTexture_);
+		Chain::Target brightness = chain_.addTarget();
+		Chain::Target firstPass = chain_.addTarget(2);
 
-		add(firstPassTexture_[0], secondPassTexture_[0], firstPassTexture_[1]);
-		firstPassTexture_[1].display();
+		chain_.addPass({ Chain::Source }, brightness, [this](const Inputs& in, sf::RenderTarget& out) { filterBright(*in[0], out); });
+		chain_.addPass({ brightness }, firstPass, [this](const Inputs& in, sf::RenderTarget& out) { downSample(*in[0], out); });
+		addBlurPasses(firstPass, 2);
 
-		add(input, firstPassTexture_[1], output);
+		auto addPass = [this](const Inputs& in, sf::RenderTarget& out) { add(*in[0], *in[1], out); };
+		if (!secondPassEnabled_)
+		{
+			chain_.addPass({ Chain::Source, firstPass }, Chain::Output, addPass);
+			return;
+		}
+
+		//quarter resolution pass, added back at half resolution before the final combine
+		Chain::Target secondPass = chain_.addTarget(4);
+		Chain::Target combined = chain_.addTarget(2);
+
+		chain_.addPass({ firstPass }, secondPass, [this](const Inputs& in, sf::RenderTarget& out) { downSample(*in[0], out); });
+		addBlurPasses(secondPass, 4);
+		chain_.addPass({ firstPass, secondPass }, combined, addPass);
+		chain_.addPass({ Chain::Source, combined }, Chain::Output, addPass);
 	}
 
-	void BloomEffect::prepareTextures(sf::Vector2u size)
+	void BloomEffect::addBlurPasses(PostEffectChain::Target target, unsigned int divisor)
 	{
-		if (brightnessTexture_.getSize() != size)
+		using Inputs = PostEffectChain::Inputs;
+
+		//vertical into a scratch target and horizontal back, the scratch returns to the pool after the last pair
+		PostEffectChain::Target scratch = chain_.addTarget(divisor);
+		for (std::size_t count = 0; count < blurPasses_; ++count)
 		{
-			brightnessTexture_.create(size.x, size.y);
-			brightnessTexture_.setSmooth(true);
-
-			firstPassTexture_[0].create(size.x / 2, size.y / 2);
-			firstPassTexture_[0].setSmooth(true);
-			firstPassTexture_[1].create(size.x / 2, size.y / 2);
-			firstPassTexture_[1].setSmooth(true);
-
-			secondPassTexture_[0].create(size.x / 4, size.y / 4);
-			secondPassTexture_[0].setSmooth(true);
-			secondPassTexture_[1].create(size.x / 4, size.y / 4);
-			secondPassTexture_[1].setSmooth(true);
+			chain_.addPass({ target }, scratch, [this](const Inputs& in, sf::RenderTarget& out)
+			{
+				blur(*in[0], out, sf::Vector2f(0.f, 1.f / in[0]->getSize().y));
+			});
+			chain_.addPass({ scratch }, target, [this](const Inputs& in, sf::RenderTarget& out)
+			{
+				blur(*in[0], out, sf::Vector2f(1.f / in[0]->getSize().x, 0.f));
+			});
 		}
 	}
 
-	void BloomEffect::filterBright(const sf::RenderTexture& input, sf::RenderTexture& output)
+	void BloomEffect::filterBright(const sf::RenderTexture& input, sf::RenderTarget& output)
 	{
 		sf::Shader& brightness = *shaders_.at(Shaders::BrightnessPass);
 
 		brightness.setUniform("source", input.getTexture());
 		applyShader(brightness, output);
-		output.display();
-	}
-
-	void BloomEffect::blurMultipass(renderTextureArray& renderTextures)
-	{
-		sf::Vector2u textureSize = renderTextures[0].getSize();
-
-		for (std::size_t count = 0; count < 2; ++count)
-		{
-			blur(renderTextures[0], renderTextures[1], sf::Vector2f(0.f, 1.f / textureSize.y));
-			blur(renderTextures[1], renderTextures[0], sf::Vector2f(1.f / textureSize.x, 0.f));
-		}
 	}
 
-	void BloomEffect::blur(const sf::RenderTexture& input, sf::RenderTexture& output, sf::Vector2f offsetFactor)
+	void BloomEffect::blur(const sf::RenderTexture& input, sf::RenderTarget& output, sf::Vector2f offsetFactor)
 	{
 		sf::Shader& gaussianBlur = *shaders_.at(Shaders::GaussianBlurPass);
 
 		gaussianBlur.setUniform("source", input.getTexture());
 		gaussianBlur.setUniform("offsetFactor", offsetFactor);
 		applyShader(gaussianBlur, output);
-		output.display();
 	}
 
-	void BloomEffect::downSample(const sf::RenderTexture& input, sf::RenderTexture& output)
+	void BloomEffect::downSample(const sf::RenderTexture& input, sf::RenderTarget& output)
 	{
 		sf::Shader& downSampler = *shaders_.at(Shaders::DownSamplePass);
 
 		downSampler.setUniform("source", input.getTexture());
 		downSampler.setUniform("sourceSize", sf::Vector2f(input.getSize()));
 		applyShader(downSampler, output);
-		output.display();
 	}
 
 	void BloomEffect::add(const sf::RenderTexture& source, const sf::RenderTexture& bloom, sf::RenderTarget& output)
@@ -29,6 +29,7 @@
 
 #pragma once
 #include "PostEffect.h"
+#include "PostEffectChain.h"
 #include <array>
 #include <map>
 #include <SFML/Graphics.hpp>
@@ -47,29 +48,30 @@ namespace GEX
 
 		};
 
-	private:
-		typedef std::array<sf::RenderTexture, 2> renderTextureArray;
-
 	public:
-														BloomEffect();
+		explicit										BloomEffect(RenderTargetPool& renderTargets);
 		void											apply(const sf::RenderTexture& input, sf::RenderTarget& output) override;
 
+		void											setBlurPasses(std::size_t passes);
+		void											setSecondPassEnabled(bool flag);	//quarter resolution pass
+
 	private:
-		void											prepareTextures(sf::Vector2u size);
-		void											filterBright(const sf::RenderTexture& input, sf::RenderTexture& output);
-		void											blurMultipass(renderTextureArray& renderTextures);
-		void											blur(const sf::RenderTexture& input, sf::RenderTexture& output, 
+		void											buildChain();	//after any setting changes
+		void											addBlurPasses(PostEffectChain::Target target, unsigned int divisor);
+
+		void											filterBright(const sf::RenderTexture& input, sf::RenderTarget& output);
+		void											blur(const sf::RenderTexture& input, sf::RenderTarget& output, 
 														     sf::Vector2f offsetFactor);
-		void											downSample(const sf::RenderTexture& input, sf::RenderTexture& output);
+		void											downSample(const sf::RenderTexture& input, sf::RenderTarget& output);
 		void											add(const sf::RenderTexture& source, const sf::RenderTexture& bloom,
 															sf::RenderTarget& target);
 
 
 	private:
 		std::map<Shaders, std::unique_ptr<sf::Shader> > shaders_;
-		sf::RenderTexture								brightnessTexture_;
-		renderTextureArray								firstPassTexture_;
-		renderTextureArray								secondPassTexture_;
+		std::size_t										blurPasses_;
+		bool											secondPassEnabled_;
+		PostEffectChain									chain_;
 	};
 
 }
\ No newline at end of file
@@ -44,7 +44,6 @@ namespace Category
 		AirSceneLayer = 1 << 6,
 		Pickup = 1 << 7,
 		ParticleSystem = 1 << 8,
-		SoundEffect = 1 << 9,
 		Aircraft = PlayerAircraft | AlliedAircraft | EnemyAircraft,
 		Projectile = EnemyProjectile | AlliedProjectile,
 		
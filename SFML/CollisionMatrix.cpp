@@ -0,0 +1,97 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "CollisionMatrix.h"
+
+namespace GEX {
+
+	CollisionMatrix::CollisionMatrix()
+		: rows_()
+	{}
+
+	CollisionMatrix CollisionMatrix::gameplay()
+	{
+		CollisionMatrix matrix;
+		matrix.enable(Category::PlayerAircraft, Category::EnemyAircraft);
+		matrix.enable(Category::PlayerAircraft, Category::Pickup);
+		matrix.enable(Category::PlayerAircraft, Category::EnemyProjectile);
+		matrix.enable(Category::EnemyAircraft, Category::AlliedProjectile);
+
+		return matrix;
+	}
+
+	void CollisionMatrix::enable(unsigned int categories1, unsigned int categories2)
+	{
+		set(categories1, categories2, true);
+	}
+
+	void CollisionMatrix::disable(unsigned int categories1, unsigned int categories2)
+	{
+		set(categories1, categories2, false);
+	}
+
+	unsigned int CollisionMatrix::getMask(unsigned int category) const
+	{
+		unsigned int mask = 0;
+		for (int bit = 0; bit < BITS; ++bit)
+		{
+			if (category & (1u << bit))
+				mask |= rows_[bit];
+		}
+
+		return mask;
+	}
+
+	bool CollisionMatrix::canCollide(unsigned int category1, unsigned int category2) const
+	{
+		return (getMask(category1) & category2) != 0;
+	}
+
+	void CollisionMatrix::set(unsigned int categories1, unsigned int categories2, bool isEnabled)
+	{
+		for (int bit = 0; bit < BITS; ++bit)
+		{
+			unsigned int row = 1u << bit;
+			if (isEnabled)
+			{
+				if (categories1 & row)
+					rows_[bit] |= categories2;
+				if (categories2 & row)
+					rows_[bit] |= categories1;
+			}
+			else
+			{
+				if (categories1 & row)
+					rows_[bit] &= ~categories2;
+				if (categories2 & row)
+					rows_[bit] &= ~categories1;
+			}
+		}
+	}
+}
@@ -0,0 +1,58 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "Category.h"
+#include <array>
+
+namespace GEX {
+
+	//which categories can collide, indexed by category bit and kept symmetric
+	class CollisionMatrix
+	{
+	public:
+										CollisionMatrix();	//nothing collides
+
+		static CollisionMatrix			gameplay();		//the pairs World responds to
+
+		void							enable(unsigned int categories1, unsigned int categories2);
+		void							disable(unsigned int categories1, unsigned int categories2);
+
+		unsigned int					getMask(unsigned int category) const;	//every category that collides with any bit of category
+		bool							canCollide(unsigned int category1, unsigned int category2) const;
+
+	private:
+		void							set(unsigned int categories1, unsigned int categories2, bool isEnabled);
+
+	private:
+		static const int				BITS = 16;
+
+		std::array<unsigned int, BITS>	rows_;
+	};
+}
@@ -0,0 +1,312 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "CpuBloomEffect.h"
+#include <SFML/Graphics/Sprite.hpp>
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GEX_BLOOM_SSE
+#endif
+
+namespace GEX
+{
+	namespace
+	{
+		//same constants as Brightness.frag and GuassianBlur.frag
+		const float THRESHOLD = 0.7f;
+		const float FACTOR = 4.f;
+		const float WEIGHTS[5] = { 0.2270270270f, 0.1945945946f, 0.1216216216f, 0.0540540541f, 0.0162162162f };
+
+		//one RGBA pixel per vector
+#ifdef GEX_BLOOM_SSE
+		typedef __m128 Vec4;
+
+		inline Vec4 vLoad(const float* p)			{ return _mm_loadu_ps(p); }
+		inline void vStore(float* p, Vec4 v)			{ _mm_storeu_ps(p, v); }
+		inline Vec4 vSplat(float f)					{ return _mm_set1_ps(f); }
+		inline Vec4 vAdd(Vec4 a, Vec4 b)				{ return _mm_add_ps(a, b); }
+		inline Vec4 vMul(Vec4 a, Vec4 b)				{ return _mm_mul_ps(a, b); }
+
+		//render textures are 8 bit, clamp and round like the GPU does on every pass
+		inline Vec4 quantize(Vec4 v)
+		{
+			v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.f));
+			__m128i rounded = _mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(255.f)));
+			return _mm_mul_ps(_mm_cvtepi32_ps(rounded), _mm_set1_ps(1.f / 255.f));
+		}
+#else
+		struct Vec4 { float c[4]; };
+
+		inline Vec4 vLoad(const float* p)			{ return Vec4{ { p[0], p[1], p[2], p[3] } }; }
+		inline void vStore(float* p, Vec4 v)			{ std::copy(v.c, v.c + 4, p); }
+		inline Vec4 vSplat(float f)					{ return Vec4{ { f, f, f, f } }; }
+		inline Vec4 vAdd(Vec4 a, Vec4 b)				{ return Vec4{ { a.c[0] + b.c[0], a.c[1] + b.c[1], a.c[2] + b.c[2], a.c[3] + b.c[3] } }; }
+		inline Vec4 vMul(Vec4 a, Vec4 b)				{ return Vec4{ { a.c[0] * b.c[0], a.c[1] * b.c[1], a.c[2] * b.c[2], a.c[3] * b.c[3] } }; }
+
+		inline Vec4 quantize(Vec4 v)
+		{
+			for (float& c : v.c)
+				c = std::round(std::min(std::max(c, 0.f), 1.f) * 255.f) / 255.f;
+			return v;
+		}
+#endif
+
+		inline int clampIndex(int i, int size)
+		{
+			return std::min(std::max(i, 0), size - 1);
+		}
+
+		//GL_LINEAR with clamp to edge, x and y in source pixel units
+		inline Vec4 sample(const float* pixels, int width, int height, float x, float y)
+		{
+			float fx = std::floor(x - 0.5f);
+			float fy = std::floor(y - 0.5f);
+			float tx = x - 0.5f - fx;
+			float ty = y - 0.5f - fy;
+
+			int x0 = clampIndex(static_cast<int>(fx), width);
+			int x1 = clampIndex(static_cast<int>(fx) + 1, width);
+			int y0 = clampIndex(static_cast<int>(fy), height);
+			int y1 = clampIndex(static_cast<int>(fy) + 1, height);
+
+			Vec4 top = vAdd(vMul(vLoad(pixels + 4 * (y0 * width + x0)), vSplat(1.f - tx)),
+				vMul(vLoad(pixels + 4 * (y0 * width + x1)), vSplat(tx)));
+			Vec4 bottom = vAdd(vMul(vLoad(pixels + 4 * (y1 * width + x0)), vSplat(1.f - tx)),
+				vMul(vLoad(pixels + 4 * (y1 * width + x1)), vSplat(tx)));
+
+			return vAdd(vMul(top, vSplat(1.f - ty)), vMul(bottom, vSplat(ty)));
+		}
+	}
+
+	void CpuBloomEffect::Buffer::resize(unsigned int w, unsigned int h)
+	{
+		width = std::max(w, 1u);
+		height = std::max(h, 1u);
+		pixels.resize(4 * width * height);
+	}
+
+	CpuBloomEffect::CpuBloomEffect(RenderTargetPool& renderTargets, ThreadPool& threads)
+		: PostEffect(renderTargets)
+		, threads_(threads)
+		, blurPasses_(2)
+		, secondPassEnabled_(true)
+	{
+	}
+
+	void CpuBloomEffect::apply(const sf::RenderTexture & input, sf::RenderTarget & output)
+	{
+		//read back, bloom on the CPU, upload and draw over the whole output
+		toBuffer(input.getTexture().copyToImage(), source_);
+		run(source_, result_);
+		toImage(result_, outputImage_);
+
+		if (outputTexture_.getSize() != outputImage_.getSize())
+			outputTexture_.create(outputImage_.getSize().x, outputImage_.getSize().y);
+		outputTexture_.update(outputImage_);
+
+		sf::Sprite sprite(outputTexture_);
+		sprite.setScale(static_cast<float>(output.getSize().x) / result_.width,
+			static_cast<float>(output.getSize().y) / result_.height);
+
+		output.draw(sprite, sf::RenderStates(sf::BlendNone));
+	}
+
+	void CpuBloomEffect::apply(const sf::Image & input, sf::Image & output)
+	{
+		toBuffer(input, source_);
+		run(source_, result_);
+		toImage(result_, output);
+	}
+
+	void CpuBloomEffect::setBlurPasses(std::size_t passes)
+	{
+		blurPasses_ = passes;
+	}
+
+	void CpuBloomEffect::setSecondPassEnabled(bool flag)
+	{
+		secondPassEnabled_ = flag;
+	}
+
+	void CpuBloomEffect::run(const Buffer & input, Buffer & output)
+	{
+		//same chain as BloomEffect::apply
+		brightness_.resize(input.width, input.height);
+		filterBright(input, brightness_);
+
+		firstPass_[0].resize(input.width / 2, input.height / 2);
+		downSample(brightness_, firstPass_[0]);
+		blurMultipass(firstPass_[0], firstPass_[1]);
+
+		output.resize(input.width, input.height);
+
+		if (!secondPassEnabled_)
+		{
+			add(input, firstPass_[0], output);
+			return;
+		}
+
+		secondPass_[0].resize(input.width / 4, input.height / 4);
+		downSample(firstPass_[0], secondPass_[0]);
+		blurMultipass(secondPass_[0], secondPass_[1]);
+
+		firstPass_[1].resize(firstPass_[0].width, firstPass_[0].height);
+		add(firstPass_[0], secondPass_[0], firstPass_[1]);
+
+		add(input, firstPass_[1], output);
+	}
+
+	void CpuBloomEffect::filterBright(const Buffer & input, Buffer & output)
+	{
+		threads_.parallelFor(input.height, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin * input.width; i < end * input.width; ++i)
+			{
+				const float* pixel = &input.pixels[4 * i];
+				float luminance = pixel[0] * 0.2126f + pixel[1] * 0.7152f + pixel[2] * 0.0722f;
+				float scale = std::min(std::max(luminance - THRESHOLD, 0.f), 1.f) * FACTOR;
+
+				vStore(&output.pixels[4 * i], quantize(vMul(vLoad(pixel), vSplat(scale))));
+			}
+		});
+	}
+
+	void CpuBloomEffect::downSample(const Buffer & input, Buffer & output)
+	{
+		const int width = static_cast<int>(input.width);
+		const int height = static_cast<int>(input.height);
+		const float scaleX = static_cast<float>(input.width) / output.width;
+		const float scaleY = static_cast<float>(input.height) / output.height;
+
+		threads_.parallelFor(output.height, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t y = begin; y < end; ++y)
+			{
+				for (std::size_t x = 0; x < output.width; ++x)
+				{
+					//texel centre of the output pixel, in source pixels
+					float sx = (x + 0.5f) * scaleX;
+					float sy = (y + 0.5f) * scaleY;
+
+					//3x3 neighbourhood, one source pixel apart, averaged
+					Vec4 color = vSplat(0.f);
+					for (int dy = -1; dy <= 1; ++dy)
+						for (int dx = -1; dx <= 1; ++dx)
+							color = vAdd(color, sample(input.pixels.data(), width, height, sx + dx, sy + dy));
+
+					vStore(&output.pixels[4 * (y * output.width + x)], quantize(vMul(color, vSplat(1.f / 9.f))));
+				}
+			}
+		});
+	}
+
+	void CpuBloomEffect::blurMultipass(Buffer & buffer, Buffer & scratch)
+	{
+		scratch.resize(buffer.width, buffer.height);
+
+		for (std::size_t count = 0; count < blurPasses_; ++count)
+		{
+			blur(buffer, scratch, true);
+			blur(scratch, buffer, false);
+		}
+	}
+
+	void CpuBloomEffect::blur(const Buffer & input, Buffer & output, bool vertical)
+	{
+		const int width = static_cast<int>(input.width);
+		const int height = static_cast<int>(input.height);
+
+		//offsets are whole pixels, so each tap lands on a texel centre and needs no filtering
+		threads_.parallelFor(input.height, [&](std::size_t begin, std::size_t end)
+		{
+			for (int y = static_cast<int>(begin); y < static_cast<int>(end); ++y)
+			{
+				for (int x = 0; x < width; ++x)
+				{
+					Vec4 color = vMul(vLoad(&input.pixels[4 * (y * width + x)]), vSplat(WEIGHTS[0]));
+
+					for (int tap = 1; tap <= 4; ++tap)
+					{
+						int before = vertical ? clampIndex(y - tap, height) * width + x : y * width + clampIndex(x - tap, width);
+						int after = vertical ? clampIndex(y + tap, height) * width + x : y * width + clampIndex(x + tap, width);
+
+						Vec4 pair = vAdd(vLoad(&input.pixels[4 * before]), vLoad(&input.pixels[4 * after]));
+						color = vAdd(color, vMul(pair, vSplat(WEIGHTS[tap])));
+					}
+
+					vStore(&output.pixels[4 * (y * width + x)], quantize(color));
+				}
+			}
+		});
+	}
+
+	void CpuBloomEffect::add(const Buffer & source, const Buffer & bloom, Buffer & output)
+	{
+		const float scaleX = static_cast<float>(bloom.width) / output.width;
+		const float scaleY = static_cast<float>(bloom.height) / output.height;
+
+		threads_.parallelFor(output.height, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t y = begin; y < end; ++y)
+			{
+				for (std::size_t x = 0; x < output.width; ++x)
+				{
+					float u = (x + 0.5f) / output.width;
+					float v = (y + 0.5f) / output.height;
+
+					Vec4 sourceColor = sample(source.pixels.data(), source.width, source.height, u * source.width, v * source.height);
+					Vec4 bloomColor = sample(bloom.pixels.data(), bloom.width, bloom.height, (x + 0.5f) * scaleX, (y + 0.5f) * scaleY);
+
+					vStore(&output.pixels[4 * (y * output.width + x)], quantize(vAdd(sourceColor, bloomColor)));
+				}
+			}
+		});
+	}
+
+	void CpuBloomEffect::toBuffer(const sf::Image & image, Buffer & buffer)
+	{
+		buffer.resize(image.getSize().x, image.getSize().y);
+
+		const sf::Uint8* bytes = image.getPixelsPtr();
+		for (std::size_t i = 0; i < buffer.pixels.size(); ++i)
+			buffer.pixels[i] = bytes[i] / 255.f;
+	}
+
+	void CpuBloomEffect::toImage(const Buffer & buffer, sf::Image & image)
+	{
+		std::vector<sf::Uint8> bytes(buffer.pixels.size());
+		for (std::size_t i = 0; i < bytes.size(); ++i)
+			bytes[i] = static_cast<sf::Uint8>(std::round(std::min(std::max(buffer.pixels[i], 0.f), 1.f) * 255.f));
+
+		image.create(buffer.width, buffer.height, bytes.data());
+	}
+}
@@ -0,0 +1,88 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "PostEffect.h"
+#include "ThreadPool.h"
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <vector>
+
+namespace GEX
+{
+	//CPU version of BloomEffect's brightness, down sample, gaussian blur and add shaders,
+	//used when shaders are unavailable and as a reference image for the GPU chain
+	class CpuBloomEffect : public PostEffect
+	{
+	public:
+											CpuBloomEffect(RenderTargetPool& renderTargets, ThreadPool& threads);
+
+		void								apply(const sf::RenderTexture& input, sf::RenderTarget& output) override;
+		void								apply(const sf::Image& input, sf::Image& output);
+
+		void								setBlurPasses(std::size_t passes);
+		void								setSecondPassEnabled(bool flag);	//quarter resolution pass
+
+	private:
+		struct Buffer	//RGBA floats, one pixel per 4 floats, rows top to bottom
+		{
+			void							resize(unsigned int w, unsigned int h);
+
+			unsigned int					width = 0;
+			unsigned int					height = 0;
+			std::vector<float>				pixels;
+		};
+
+	private:
+		void								run(const Buffer& input, Buffer& output);
+
+		void								filterBright(const Buffer& input, Buffer& output);
+		void								downSample(const Buffer& input, Buffer& output);
+		void								blurMultipass(Buffer& buffer, Buffer& scratch);
+		void								blur(const Buffer& input, Buffer& output, bool vertical);
+		void								add(const Buffer& source, const Buffer& bloom, Buffer& output);
+
+		static void							toBuffer(const sf::Image& image, Buffer& buffer);
+		static void							toImage(const Buffer& buffer, sf::Image& image);
+
+	private:
+		ThreadPool&							threads_;
+		std::size_t							blurPasses_;
+		bool								secondPassEnabled_;
+
+		Buffer								source_;
+		Buffer								brightness_;
+		Buffer								firstPass_[2];
+		Buffer								secondPass_[2];
+		Buffer								result_;
+
+		sf::Image							outputImage_;
+		sf::Texture							outputTexture_;
+	};
+}
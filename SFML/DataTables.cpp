@@ -31,24 +31,35 @@
 #include "DataTables.h"
 
 namespace GEX {
+	GameData::GameData()
+		: aircraft(initializeAircraftData())
+		, projectiles(initializeProjectileData())
+		, pickups(initializePickupData())
+	{
+	}
+
 	std::map<Pickup::Type, PickupData> initializePickupData()
 	{
 		std::map<Pickup::Type, PickupData> data;
 		
 		data[Pickup::Type::HealthRefill].texture = TextureID::Entities;
-		data[Pickup::Type::HealthRefill].action = [](Aircraft& a) {a.repair(25); };
+		data[Pickup::Type::HealthRefill].action = [](Aircraft& a, int value) {a.repair(value); };
+		data[Pickup::Type::HealthRefill].value = 25;
 		data[Pickup::Type::HealthRefill].textureRect = sf::IntRect(0, 64, 40, 40);
 
 		data[Pickup::Type::MissileRefill].texture = TextureID::Entities;
-		data[Pickup::Type::MissileRefill].action = [](Aircraft& a) {a.collectMissiles(3); };
+		data[Pickup::Type::MissileRefill].action = [](Aircraft& a, int value) {a.collectMissiles(value); };
+		data[Pickup::Type::MissileRefill].value = 3;
 		data[Pickup::Type::MissileRefill].textureRect = sf::IntRect(40, 64, 40, 40);
 
 		data[Pickup::Type::FireSpread].texture = TextureID::Entities;
-		data[Pickup::Type::FireSpread].action = [](Aircraft& a) {a.increaseFireSpread(); };
+		data[Pickup::Type::FireSpread].action = [](Aircraft& a, int) {a.increaseFireSpread(); };
+		data[Pickup::Type::FireSpread].value = 0;
 		data[Pickup::Type::FireSpread].textureRect = sf::IntRect(80, 64, 40, 40);
 
 		data[Pickup::Type::FireRate].texture = TextureID::Entities;
-		data[Pickup::Type::FireRate].action = [](Aircraft& a) {a.increaseFireRate(); };
+		data[Pickup::Type::FireRate].action = [](Aircraft& a, int) {a.increaseFireRate(); };
+		data[Pickup::Type::FireRate].value = 0;
 		data[Pickup::Type::FireRate].textureRect = sf::IntRect(120, 64, 40, 40);
 
 
@@ -74,9 +85,12 @@ namespace GEX {
 		data[AircraftType::Raptor].textureRect = sf::IntRect(144, 0, 84, 64);
 		data[AircraftType::Raptor].hasRollAnimation = false;
 
-		data[AircraftType::Raptor].directions.emplace_back(Direction(45.f, 80.f));
-		data[AircraftType::Raptor].directions.emplace_back(Direction(-45.f, 160.f));
-		data[AircraftType::Raptor].directions.emplace_back(Direction(45.f, 80.f));
+		data[AircraftType::Raptor].behaviour = {
+			BehaviourStep::move(45.f, 80.f),
+			BehaviourStep::move(-45.f, 160.f),
+			BehaviourStep::move(45.f, 80.f),
+			BehaviourStep::repeat()
+		};
 
 		data[AircraftType::Avenger].hitPoints = 40;
 		data[AircraftType::Avenger].speed = 50.f;
@@ -85,11 +99,14 @@ namespace GEX {
 		data[AircraftType::Avenger].textureRect = sf::IntRect(228, 0, 60, 59);
 		data[AircraftType::Avenger].hasRollAnimation = false;
 
-		data[AircraftType::Avenger].directions.emplace_back(Direction(45.f, 50.f));
-		data[AircraftType::Avenger].directions.emplace_back(Direction(0.f, 50.f));
-		data[AircraftType::Avenger].directions.emplace_back(Direction(-45.f, 100.f));
-		data[AircraftType::Avenger].directions.emplace_back(Direction(0.f, 50.f));
-		data[AircraftType::Avenger].directions.emplace_back(Direction(45.f, 50.f));
+		data[AircraftType::Avenger].behaviour = {
+			BehaviourStep::move(45.f, 50.f),
+			BehaviourStep::move(0.f, 50.f),
+			BehaviourStep::move(-45.f, 100.f),
+			BehaviourStep::move(0.f, 50.f),
+			BehaviourStep::move(45.f, 50.f),
+			BehaviourStep::repeat()
+		};
 
 		return data;
 	}
@@ -124,10 +141,40 @@ namespace GEX {
 
 		data[Particle::Type::Propellant].color = sf::Color(255, 255, 50);
 		data[Particle::Type::Propellant].lifetime = sf::seconds(0.6f);
+		data[Particle::Type::Propellant].budget = 1000;
 
 		data[Particle::Type::Smoke].color = sf::Color(50, 50, 50);
 		data[Particle::Type::Smoke].lifetime = sf::seconds(4.f);
+		data[Particle::Type::Smoke].budget = 3000;
+
 
+		return data;
+	}
+
+	std::map<QualityTier, QualityData> initializeQualityData()
+	{
+		std::map<QualityTier, QualityData> data;
+
+		data[QualityTier::High].bloomBlurPasses = 2;
+		data[QualityTier::High].bloomSecondPass = true;
+		data[QualityTier::High].emissionRate = 30.f;
+		data[QualityTier::High].particleBudget = 1.f;
+		data[QualityTier::High].showLabels = true;
+		data[QualityTier::High].cpuBloomFallback = true;
+
+		data[QualityTier::Medium].bloomBlurPasses = 1;
+		data[QualityTier::Medium].bloomSecondPass = true;
+		data[QualityTier::Medium].emissionRate = 20.f;
+		data[QualityTier::Medium].particleBudget = 0.5f;
+		data[QualityTier::Medium].showLabels = true;
+		data[QualityTier::Medium].cpuBloomFallback = false;
+
+		data[QualityTier::Low].bloomBlurPasses = 1;
+		data[QualityTier::Low].bloomSecondPass = false;
+		data[QualityTier::Low].emissionRate = 10.f;
+		data[QualityTier::Low].particleBudget = 0.2f;
+		data[QualityTier::Low].showLabels = false;
+		data[QualityTier::Low].cpuBloomFallback = false;
 
 		return data;
 	}
@@ -35,32 +35,23 @@
 #include "Projectile.h"
 #include "Pickup.h"
 #include "Particle.h"
+#include "QualityGovernor.h"
+#include "Behaviour.h"
 
 namespace GEX {
 	//compilation unit 
 	//declaring data structures 
 
-	struct Direction
-	{
-		Direction(float a, float d)
-			: angle(a)
-			, distance(d)
-		{}
-
-		float								angle;
-		float								distance;
-	};
-
 	struct AircraftData
 	{
 		int										hitPoints;
 		float									speed;
 		TextureID								texture;
 		sf::Time								fireInterval; //how frequently bullets can fire
-		sf::IntRect								textureRect;
+		sf::IntRect								textureRect;	//within the source image, see TextureRegion::map
 		bool									hasRollAnimation;
 
-		std::vector<Direction>					directions;
+		BehaviourScript							behaviour;	//empty for the player; enemies that script bursts only fire in them
 	};
 
 	struct ProjectileData
@@ -68,24 +59,47 @@ namespace GEX {
 		int										damage;
 		float									speed;
 		TextureID								texture;
-		sf::IntRect								textureRect;
+		sf::IntRect								textureRect;	//within the source image, see TextureRegion::map
 	};
 
 	struct PickupData
 	{
-		std::function<void(Aircraft&)>			action;
+		std::function<void(Aircraft&, int)>		action;		//called with value
+		int										value;		//hit points or missiles given, unused by upgrades
 		TextureID								texture;
-		sf::IntRect								textureRect;
+		sf::IntRect								textureRect;	//within the source image, see TextureRegion::map
 	};
 
 	struct ParticleData
 	{
 		sf::Color								color;
 		sf::Time								lifetime;
+		std::size_t								budget;		//live particles at full quality, emission thins out well before it
+	};
+
+	struct QualityData
+	{
+		std::size_t								bloomBlurPasses;
+		bool									bloomSecondPass;	//extra quarter resolution pass
+		float									emissionRate;		//particles per second per emitter
+		float									particleBudget;		//share of each type's budget
+		bool									showLabels;
+		bool									cpuBloomFallback;	//bloom on the CPU when shaders are unsupported
+	};
+
+	//gameplay tables, copied per World so Worlds can be tuned independently
+	struct GameData
+	{
+												GameData();	//filled from the initialize functions below
+
+		std::map<AircraftType, AircraftData>		aircraft;
+		std::map<Projectile::Type, ProjectileData>	projectiles;
+		std::map<Pickup::Type, PickupData>			pickups;
 	};
 
 	std::map<Pickup::Type, PickupData>			initializePickupData();
 	std::map<AircraftType, AircraftData>		initializeAircraftData();
 	std::map<Projectile::Type, ProjectileData>	initializeProjectileData();
 	std::map<Particle::Type, ParticleData>		initializeParticleData();
+	std::map<QualityTier, QualityData>			initializeQualityData();
 }
\ No newline at end of file
@@ -29,51 +29,48 @@
 
 
 #include "EmitterNode.h"
-#include "Command.h"
-#include "CommandQueue.h"
 #include "ParticleNode.h"
 
 namespace GEX {
-	EmitterNode::EmitterNode(Particle::Type type)
+	EmitterNode::EmitterNode(Particle::Type type, const ParticleRegistry& particleSystems)
 		: SceneNode()
 		, accumulatedTime_(sf::Time::Zero)
 	    , type_(type)
-	    , particleSystem_(nullptr)
+	    , particleSystems_(particleSystems)
+	    , particleSystem_()
 	{}
 
-	void EmitterNode::updateCurrent(sf::Time dt, CommandQueue & commands)
+	void EmitterNode::updateCurrent(sf::Time dt, CommandQueue &)
 	{
-		if (particleSystem_)
+		if (ParticleNode* particleSystem = getParticleSystem())
 		{
-			emitParticle(dt);
+			emitParticle(*particleSystem, dt);
 		}
-		else
-		{
-			auto finder = [this](ParticleNode& container, sf::Time dt) {
-				if (container.getParticleType() == type_)
-				{
-					particleSystem_ = &container;
-				}
-			};
-			Command command;
-			command.category = Category::Type::ParticleSystem;
-			command.action = derivedAction<ParticleNode>(finder);
+	}
 
-			commands.push(command);
-		}
+	ParticleNode * EmitterNode::getParticleSystem()
+	{
+		if (ParticleNode* particleSystem = resolve<ParticleNode>(particleSystem_))
+			return particleSystem;
+
+		particleSystem_ = particleSystems_.getHandle(type_);
+		return resolve<ParticleNode>(particleSystem_);
 	}
 
-	void EmitterNode::emitParticle(sf::Time dt)
+	void EmitterNode::emitParticle(ParticleNode& particleSystem, sf::Time dt)
 	{
-		const float EMISSION_RATE = 30.f;
-		const sf::Time INTERVAL = sf::seconds(1.f) / EMISSION_RATE;
+		const float emissionRate = particleSystem.getEmissionRate();
+		if (emissionRate <= 0.f)
+			return;
+
+		const sf::Time INTERVAL = sf::seconds(1.f) / emissionRate;
 
 		accumulatedTime_ += dt;
 
 		while (accumulatedTime_ > INTERVAL)
 		{
 			accumulatedTime_ -= INTERVAL;
-			particleSystem_->addParticle(getWorldPosition());
+			particleSystem.addParticle(getWorldPosition());
 		}
 
 	}
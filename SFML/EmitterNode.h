@@ -32,21 +32,24 @@
 #include "SceneNode.h"
 #include "Particle.h"
 #include "ParticleNode.h"
+#include "ParticleRegistry.h"
 
 namespace GEX {
 	class EmitterNode : public SceneNode
 	{
 	public:
-		explicit				EmitterNode(Particle::Type type);
+								EmitterNode(Particle::Type type, const ParticleRegistry& particleSystems);
 
 	private:
 		void					updateCurrent(sf::Time dt, CommandQueue& commands) override;
-		void					emitParticle(sf::Time dt);
+		ParticleNode*			getParticleSystem();	//the bound system, rebound through the registry once it goes stale
+		void					emitParticle(ParticleNode& particleSystem, sf::Time dt);
 
 	private:
 		sf::Time				accumulatedTime_;
 		Particle::Type			type_;
-		ParticleNode*			particleSystem_;
+		const ParticleRegistry&	particleSystems_;
+		Handle					particleSystem_;	//default until the first update binds it
 	};
 
 }
\ No newline at end of file
@@ -34,7 +34,11 @@
 namespace GEX {
 
 	Entity::Entity(int points)
-		: hitPoints_(points)
+		: velocity_()
+		, hitPoints_(points)
+		, boundingBox_()
+		, orientedBox_()
+		, isBoundingBoxValid_(false)
 	{}
 
 	void Entity::setVelocity(sf::Vector2f velocity)
@@ -100,4 +104,52 @@ namespace GEX {
 	{
 		move(getVelocity() * dt.asSeconds());
 	};
+
+	void Entity::save(Snapshot & snapshot) const
+	{
+		snapshot.position = getPosition();
+		snapshot.rotation = getRotation();
+		snapshot.velocity = velocity_;
+		snapshot.hitPoints = hitPoints_;
+	}
+
+	void Entity::restore(const Snapshot & snapshot)
+	{
+		setPosition(snapshot.position);
+		setRotation(snapshot.rotation);
+		velocity_ = snapshot.velocity;
+		hitPoints_ = snapshot.hitPoints;
+		isBoundingBoxValid_ = false;
+	}
+
+	sf::FloatRect Entity::getBoundingBox() const
+	{
+		if (!isBoundingBoxValid_)
+			refreshBounds();
+
+		return boundingBox_;
+	}
+
+	const OrientedBox & Entity::getOrientedBox() const
+	{
+		if (!isBoundingBoxValid_)
+			refreshBounds();
+
+		return orientedBox_;
+	}
+
+	void Entity::updateBoundingBox()
+	{
+		refreshBounds();
+	}
+
+	void Entity::refreshBounds() const
+	{
+		sf::Transform transform = getWorldTransform();
+		sf::FloatRect bounds = getLocalBounds();
+
+		boundingBox_ = transform.transformRect(bounds);
+		orientedBox_ = OrientedBox::fromRect(transform, bounds);
+		isBoundingBoxValid_ = true;
+	}
 }
\ No newline at end of file
@@ -29,10 +29,21 @@
 
 #pragma once
 #include "SceneNode.h"
+#include "OrientedBox.h"
 
 namespace GEX {
 	class Entity : public SceneNode
 	{
+	public:
+		//simulation state shared by all entities, extended by each subclass
+		struct Snapshot
+		{
+			sf::Vector2f		position;
+			float				rotation;
+			sf::Vector2f		velocity;
+			int					hitPoints;
+		};
+
 	public:
 
 		explicit				Entity(int points);
@@ -55,15 +66,31 @@ namespace GEX {
 		bool			        isDestroyed() const override;
 		virtual void			remove();
 
+								//cached, refreshed by updateBoundingBox once a tick after integration,
+								//computed on first use for entities spawned since
+		sf::FloatRect			getBoundingBox() const override final;
+		const OrientedBox&		getOrientedBox() const;		//tighter than the bounding box once rotated
+		void					updateBoundingBox();
+
 
 	protected:
 		virtual void			updateCurrent(sf::Time dt, CommandQueue& comands) override;
 
+		void					save(Snapshot& snapshot) const;
+		void					restore(const Snapshot& snapshot);
 
+		virtual sf::FloatRect	getLocalBounds() const = 0;	//before the world transform
+
+
+	private:
+		void					refreshBounds() const;
 
 	private:
 		sf::Vector2f			velocity_;
 		int						hitPoints_;
+		mutable sf::FloatRect	boundingBox_;
+		mutable OrientedBox		orientedBox_;
+		mutable bool			isBoundingBoxValid_;
 
 
 	};
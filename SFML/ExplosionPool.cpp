@@ -0,0 +1,95 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "ExplosionPool.h"
+#include "Utility.h"
+#include <cassert>
+#include <algorithm>
+
+namespace GEX {
+
+	namespace
+	{
+		const sf::Vector2i	FRAME_SIZE(256, 256);
+		const std::size_t	NUM_FRAMES = 16;
+		const sf::Time		DURATION = sf::seconds(1);
+	}
+
+	ExplosionPool::ExplosionPool()
+		: texture_(nullptr)
+		, frames_()
+		, explosions_()
+		, available_()
+	{
+	}
+
+	void ExplosionPool::setTexture(const TextureRegion & texture)
+	{
+		texture_ = texture.texture;
+		frames_.clear();
+
+		//frames laid out left to right, top to bottom
+		int columns = std::max(texture.rect.width / FRAME_SIZE.x, 1);
+
+		for (std::size_t i = 0; i < NUM_FRAMES; ++i)
+		{
+			int column = static_cast<int>(i) % columns;
+			int row = static_cast<int>(i) / columns;
+			frames_.push_back(texture.map(sf::IntRect(column * FRAME_SIZE.x, row * FRAME_SIZE.y, FRAME_SIZE.x, FRAME_SIZE.y)));
+		}
+	}
+
+	Animation* ExplosionPool::acquire()
+	{
+		assert(texture_ != nullptr);
+
+		if (available_.empty())
+		{
+			std::unique_ptr<Animation> explosion(new Animation(*texture_));
+			explosion->setFrames(frames_);
+			explosion->setDuration(DURATION);
+			centerOrigin(*explosion);
+
+			available_.push_back(explosion.get());
+			explosions_.push_back(std::move(explosion));
+		}
+
+		Animation* explosion = available_.back();
+		available_.pop_back();
+
+		explosion->restart();
+		return explosion;
+	}
+
+	void ExplosionPool::release(Animation* explosion)
+	{
+		assert(explosion != nullptr);
+		available_.push_back(explosion);
+	}
+}
@@ -0,0 +1,58 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "Animation.h"
+#include "TextureAtlas.h"
+#include <vector>
+#include <memory>
+
+namespace GEX {
+
+	//shared explosion animations, borrowed by aircraft when they die
+	class ExplosionPool
+	{
+	public:
+													ExplosionPool();
+													ExplosionPool(const ExplosionPool&) = delete;
+		ExplosionPool&								operator=(const ExplosionPool&) = delete;
+
+													//set explosion sheet and pre-compute its frame rects
+		void										setTexture(const TextureRegion& texture);
+
+		Animation*									acquire();	//borrow a restarted explosion
+		void										release(Animation* explosion);	//hand it back
+
+	private:
+		const sf::Texture*							texture_;
+		std::vector<sf::IntRect>					frames_;
+		std::vector<std::unique_ptr<Animation>>		explosions_;	//owns every instance ever created
+		std::vector<Animation*>						available_;
+	};
+}
@@ -0,0 +1,95 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "FixedTimestep.h"
+#include <algorithm>
+#include <cassert>
+
+namespace GEX {
+
+	FixedTimestep::FixedTimestep(unsigned int ticksPerSecond, unsigned int maxStepsPerFrame)
+		: tickTime_()
+		, maxStepsPerFrame_(std::max(maxStepsPerFrame, 1u))
+		, accumulator_(sf::Time::Zero)
+		, stepsThisFrame_(0)
+		, tickCount_(0)
+	{
+		setTickRate(ticksPerSecond);
+	}
+
+	void FixedTimestep::setTickRate(unsigned int ticksPerSecond)
+	{
+		assert(ticksPerSecond > 0);
+		tickTime_ = sf::microseconds(1000000 / std::max(ticksPerSecond, 1u));
+	}
+
+	void FixedTimestep::setMaxStepsPerFrame(unsigned int steps)
+	{
+		maxStepsPerFrame_ = std::max(steps, 1u);
+	}
+
+	void FixedTimestep::addFrameTime(sf::Time frameTime)
+	{
+		accumulator_ += frameTime;
+		stepsThisFrame_ = 0;
+	}
+
+	bool FixedTimestep::step()
+	{
+		if (accumulator_ < tickTime_)
+			return false;
+
+		if (stepsThisFrame_ == maxStepsPerFrame_)
+		{
+			//too far behind, drop the whole ticks and keep only the partial one
+			accumulator_ = sf::microseconds(accumulator_.asMicroseconds() % tickTime_.asMicroseconds());
+			return false;
+		}
+
+		accumulator_ -= tickTime_;
+		++stepsThisFrame_;
+		++tickCount_;
+		return true;
+	}
+
+	sf::Time FixedTimestep::getTickTime() const
+	{
+		return tickTime_;
+	}
+
+	float FixedTimestep::getAlpha() const
+	{
+		return std::min(accumulator_ / tickTime_, 1.f);
+	}
+
+	std::size_t FixedTimestep::getTickCount() const
+	{
+		return tickCount_;
+	}
+}
@@ -0,0 +1,59 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/System/Time.hpp>
+#include <cstddef>
+
+namespace GEX {
+
+	//fixed rate simulation clock: real frame time goes in, whole ticks come out,
+	//and what is left over tells rendering how far it is into the next tick
+	class FixedTimestep
+	{
+	public:
+		explicit				FixedTimestep(unsigned int ticksPerSecond = 60, unsigned int maxStepsPerFrame = 5);
+
+		void					setTickRate(unsigned int ticksPerSecond);
+		void					setMaxStepsPerFrame(unsigned int steps);	//catch up limit, stops a slow tick snowballing
+
+		void					addFrameTime(sf::Time frameTime);
+		bool					step();				//true while another tick should run this frame
+		sf::Time				getTickTime() const;
+		float					getAlpha() const;	//0 to 1, progress towards the next tick
+		std::size_t				getTickCount() const;	//ticks run so far
+
+	private:
+		sf::Time				tickTime_;
+		unsigned int			maxStepsPerFrame_;
+		sf::Time				accumulator_;
+		unsigned int			stepsThisFrame_;
+		std::size_t				tickCount_;
+	};
+}
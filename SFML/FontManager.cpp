@@ -32,15 +32,11 @@
 
 namespace GEX 
 {
-	FontManager* FontManager::instance_ = nullptr;  //init class variable instance_ to nullptr
-	
-
 	FontManager& FontManager::getInstance()
 	{
-		if (!instance_)
-			FontManager::instance_ = new FontManager();
-
-		return *FontManager::instance_;
+		//function statics are initialised once, even when first called from several threads
+		static FontManager instance;
+		return instance;
 	}
 
 	void FontManager::load(FontID id,const std::string & path)
@@ -50,6 +46,7 @@ namespace GEX
 		if (!font->loadFromFile(path))
 			throw std::runtime_error("Font load failed" + path);
 
+		std::lock_guard<std::mutex> lock(mutex_);
 		auto rc = fonts_.insert(std::make_pair(id, std::move(font)));
 
 		if (!rc.second)
@@ -58,9 +55,16 @@ namespace GEX
 
 	sf::Font& FontManager::get(FontID id) const
 	{
+		std::lock_guard<std::mutex> lock(mutex_);
 		auto found = fonts_.find(id);
 		assert(found != fonts_.end());
 
 		return *found->second;
 	}
+
+	bool FontManager::isLoaded(FontID id) const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return fonts_.find(id) != fonts_.end();
+	}
 }
\ No newline at end of file
@@ -31,6 +31,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <mutex>
 #include "ResourceIdentifiers.h"
 #include <SFML/Graphics/Font.hpp>
 
@@ -46,9 +47,10 @@ namespace GEX {
 
 		void											load(FontID id,const std::string& path);
 		sf::Font&										get(FontID id) const;
+		bool											isLoaded(FontID id) const;
 
 	private:
-		static FontManager*								instance_;
+		mutable std::mutex								mutex_;		//Worlds on worker threads look fonts up too
 		std::map<FontID, std::unique_ptr<sf::Font> >    fonts_;
 	};
 
@@ -45,7 +45,7 @@ namespace GEX {
 		gameOvertext_.setFont(font);
 		if (context.player->getMissionStatus() == GEX::MissionStatus::MissionFailure)
 		{
-			gameOvertext_.setString("Mission Failed");
+			gameOvertext_.setString("Mission Failed\n  R to retry");
 		}
 		else
 		{
@@ -83,6 +83,13 @@ namespace GEX {
 
 	bool GameOverState::handleEvent(const sf::Event & event)
 	{
+		//GameState rewinds itself when it sees the retry status
+		if (getContext().player->getMissionStatus() == GEX::MissionStatus::MissionFailure &&
+			event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::R)
+		{
+			getContext().player->setMissionStatus(GEX::MissionStatus::MissionRetry);
+			requestStackPop();
+		}
 		return false;
 	}
 }
\ No newline at end of file
@@ -29,13 +29,19 @@
 
 #include "GameState.h"
 
-
+namespace
+{
+	const sf::Time CHECKPOINT_AGE = sf::seconds(3.f);	//how far back retry rewinds
+}
 
 GameState::GameState(GEX::StateStack& stack, State::Context context)
 	: State(stack, context)
-	, world_(*context.window, *context.sound)
+	, world_(*context.window, *context.sound, *context.renderTargets, *context.threads)
 	, player_(*context.player)
+	, lastUpdateTick_(0)
+	, history_(static_cast<std::size_t>(CHECKPOINT_AGE / context.timestep->getTickTime()))
 {
+	world_.saveSnapshot(history_.push());
 
 	context.music->play(GEX::MusicID::MissionTheme);
 }
@@ -43,12 +49,25 @@ GameState::GameState(GEX::StateStack& stack, State::Context context)
 
 void GameState::draw()
 {
-	world_.draw();
+	//only blend if the world ran on the latest tick, otherwise it is paused and blending would jitter
+	const GEX::FixedTimestep& timestep = *getContext().timestep;
+	world_.draw(lastUpdateTick_ == timestep.getTickCount() ? timestep.getAlpha() : 1.f);
 }
 
 bool GameState::update(sf::Time dt)
 {
+	lastUpdateTick_ = getContext().timestep->getTickCount();
+
+	if (player_.getMissionStatus() == GEX::MissionStatus::MissionRetry)
+	{
+		world_.restoreSnapshot(history_.oldest());
+		history_.clear();
+		world_.saveSnapshot(history_.push());
+		player_.setMissionStatus(GEX::MissionStatus::MissionRunning);
+	}
+
 	auto& commands = world_.getCommandQueue();
+	world_.setQualityTier(getContext().quality->getTier());
 	world_.update(dt, commands);
 
 	if (!world_.hasAlivePlayer())
@@ -61,6 +80,10 @@ bool GameState::update(sf::Time dt)
 		player_.setMissionStatus(GEX::MissionStatus::MissionSuccess);
 		requestStackPush(GEX::StateID::GameOver);
 	}
+	else
+	{
+		world_.saveSnapshot(history_.push());
+	}
 
 	player_.handleRealtimeInput(commands);
 	return true;
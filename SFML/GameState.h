@@ -49,6 +49,8 @@ public:
 private:
 	GEX::World				world_;
 	GEX::PlayerControl&		player_;
+	std::size_t				lastUpdateTick_;	//timestep tick the world last ran on
+	GEX::SnapshotRing		history_;			//one snapshot per tick, the oldest is the retry checkpoint
 
 };
 
@@ -0,0 +1,79 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "GameplayEventBus.h"
+
+namespace GEX {
+
+	GameplayEventBus::GameplayEventBus()
+		: pending_()
+		, subscribers_()
+		, dispatching_()
+	{}
+
+	void GameplayEventBus::subscribe(GameplayEvent::Type type, Subscriber subscriber)
+	{
+		subscribers_[static_cast<std::size_t>(type)].push_back(std::move(subscriber));
+	}
+
+	void GameplayEventBus::publish(const GameplayEvent & event)
+	{
+		//nobody listening, nothing to keep
+		std::size_t type = static_cast<std::size_t>(event.type);
+		if (!subscribers_[type].empty())
+			pending_[type].push_back(event);
+	}
+
+	void GameplayEventBus::dispatch()
+	{
+		for (std::size_t type = 0; type < TYPE_COUNT; ++type)
+		{
+			if (pending_[type].empty())
+				continue;
+
+			dispatching_.swap(pending_[type]);
+			for (const Subscriber& subscriber : subscribers_[type])
+			{
+				subscriber(dispatching_);
+			}
+			dispatching_.clear();
+		}
+	}
+
+	std::size_t GameplayEventBus::getPendingCount() const
+	{
+		std::size_t count = 0;
+		for (const Batch& batch : pending_)
+		{
+			count += batch.size();
+		}
+
+		return count;
+	}
+}
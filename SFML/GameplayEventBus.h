@@ -0,0 +1,83 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <array>
+#include <functional>
+#include <vector>
+
+namespace GEX {
+
+	struct GameplayEvent
+	{
+		enum class Type
+		{
+			Damaged,
+			Destroyed,
+			PickupCollected,
+			ShotFired,
+			TypeCount
+		};
+
+		Type						type;
+		unsigned int				category;	//of the entity the event is about
+		sf::Vector2f				position;
+		int							value;		//damage taken, pickup type or projectile type
+	};
+
+	//gameplay events collected during a tick and handed to subscribers in one batch per type
+	class GameplayEventBus
+	{
+	public:
+		using Batch = std::vector<GameplayEvent>;
+		using Subscriber = std::function<void(const Batch&)>;
+
+	public:
+									GameplayEventBus();
+									GameplayEventBus(const GameplayEventBus&) = delete;
+		GameplayEventBus&			operator=(const GameplayEventBus&) = delete;
+
+		void						subscribe(GameplayEvent::Type type, Subscriber subscriber);
+
+									//appends only, no locking, so call it from the thread running the tick
+		void						publish(const GameplayEvent& event);
+
+									//batches go out in type order, events published meanwhile wait for the next call
+		void						dispatch();
+		std::size_t					getPendingCount() const;
+
+	private:
+		static const std::size_t	TYPE_COUNT = static_cast<std::size_t>(GameplayEvent::Type::TypeCount);
+
+		std::array<Batch, TYPE_COUNT>					pending_;
+		std::array<std::vector<Subscriber>, TYPE_COUNT>	subscribers_;
+		Batch											dispatching_;	//swapped with a pending batch, keeps its capacity
+	};
+}
@@ -61,7 +61,9 @@ GexState::GexState(GEX::StateStack & stack, State::Context context)
 
 	
 	sf::Vector2f viewSize = context.window->getView().getSize();
-	backgroundSprite_.setTexture(context.textures->get(GEX::TextureID::Face));
+	GEX::TextureRegion texture = context.textures->get(GEX::TextureID::Face);
+	backgroundSprite_.setTexture(*texture.texture);
+	backgroundSprite_.setTextureRect(texture.rect);
 	centerOrigin(backgroundSprite_);
 	backgroundSprite_.setPosition(viewSize.x / 2.f, viewSize.y / 2.f);
 	backgroundSprite_.setColor(sf::Color(255, 255, 255, 128));
@@ -0,0 +1,158 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace GEX {
+
+	//weak reference into a HandleTable, a default handle never resolves
+	struct Handle
+	{
+		bool						operator==(const Handle& other) const
+		{
+			return index == other.index && generation == other.generation && table == other.table;
+		}
+		bool						operator!=(const Handle& other) const { return !(*this == other); }
+
+		std::uint32_t				index = 0;
+		std::uint32_t				generation = 0;
+		std::uint32_t				table = 0;		//id of the table that issued it, 0 for a default handle
+	};
+
+	//ids start at 1 and are unique across all tables and threads
+	inline std::uint32_t			nextHandleTableId()
+	{
+		static std::atomic<std::uint32_t> next(1);
+		return next++;
+	}
+
+	//slot table from handles to objects, O(1) resolve, stale once the object is removed
+	template <typename T>
+	class HandleTable
+	{
+	public:
+									HandleTable();
+									HandleTable(const HandleTable&) = delete;
+		HandleTable&				operator=(const HandleTable&) = delete;
+
+		Handle						insert(T* object);
+		void						remove(Handle handle);			//every copy of the handle goes stale
+		void						relocate(Handle handle, T* object);	//the object moved, its handles follow
+		T*							resolve(Handle handle) const;	//null when stale, asserts on another table's handle
+		std::size_t					size() const;
+
+	private:
+		struct Entry
+		{
+			T*						object;
+			std::uint32_t			generation;		//starts at 1, bumped on remove
+		};
+
+	private:
+		std::uint32_t				id_;
+		std::vector<Entry>			entries_;
+		std::vector<std::uint32_t>	freeEntries_;
+	};
+
+	template <typename T>
+	HandleTable<T>::HandleTable()
+		: id_(nextHandleTableId())
+		, entries_()
+		, freeEntries_()
+	{
+	}
+
+	template <typename T>
+	Handle HandleTable<T>::insert(T* object)
+	{
+		assert(object != nullptr);
+
+		std::uint32_t index;
+		if (!freeEntries_.empty())
+		{
+			index = freeEntries_.back();
+			freeEntries_.pop_back();
+		}
+		else
+		{
+			index = static_cast<std::uint32_t>(entries_.size());
+			entries_.push_back(Entry{ nullptr, 1 });
+		}
+
+		entries_[index].object = object;
+
+		Handle handle;
+		handle.index = index;
+		handle.generation = entries_[index].generation;
+		handle.table = id_;
+		return handle;
+	}
+
+	template <typename T>
+	void HandleTable<T>::remove(Handle handle)
+	{
+		if (!resolve(handle))
+			return;
+
+		Entry& entry = entries_[handle.index];
+		entry.object = nullptr;
+		++entry.generation;
+
+		freeEntries_.push_back(handle.index);
+	}
+
+	template <typename T>
+	void HandleTable<T>::relocate(Handle handle, T* object)
+	{
+		assert(resolve(handle) != nullptr && object != nullptr);
+		entries_[handle.index].object = object;
+	}
+
+	template <typename T>
+	T* HandleTable<T>::resolve(Handle handle) const
+	{
+		//a handle from another table, such as another thread's scene nodes, would alias an unrelated entry
+		assert((handle.table == id_ || handle.table == 0) && "handle resolved against the wrong table");
+		if (handle.table != id_ || handle.index >= entries_.size())
+			return nullptr;
+
+		const Entry& entry = entries_[handle.index];
+		return entry.generation == handle.generation ? entry.object : nullptr;
+	}
+
+	template <typename T>
+	std::size_t HandleTable<T>::size() const
+	{
+		return entries_.size() - freeEntries_.size();
+	}
+}
@@ -0,0 +1,310 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "LevelFile.h"
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace GEX {
+
+	namespace
+	{
+		const char				MAGIC[4] = { 'G', 'E', 'X', 'L' };
+		const std::uint32_t		VERSION = 3;	//2 added sourceHash, 3 sourceSize
+		const std::size_t		BLOCK_SIZE = 64;	//records read per refill
+
+		//on disk layout, native byte order
+		struct Header
+		{
+			char				magic[4];
+			std::uint32_t		version;
+			float				length;
+			std::uint32_t		count;
+			std::uint32_t		sourceHash;	//of the text it was compiled from
+			std::uint32_t		sourceSize;	//in bytes, a cheap first check before hashing
+		};
+
+		struct Record
+		{
+			std::uint32_t		type;
+			float				x;
+			float				distance;
+		};
+
+		const std::map<std::string, AircraftType> TYPE_NAMES = {
+			{ "Eagle", AircraftType::Eagle },
+			{ "Raptor", AircraftType::Raptor },
+			{ "Avenger", AircraftType::Avenger },
+		};
+
+		//FNV-1a, enough to notice an edited level
+		std::uint32_t hashText(const std::string& text)
+		{
+			std::uint32_t hash = 2166136261u;
+			for (char c : text)
+			{
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 16777619u;
+			}
+			return hash;
+		}
+
+		bool readText(const std::string& path, std::string& text)
+		{
+			std::ifstream in(path, std::ios::binary);
+			if (!in)
+				return false;
+
+			std::ostringstream contents;
+			contents << in.rdbuf();
+			text = contents.str();
+			return true;
+		}
+
+		bool isKnownType(std::uint32_t type)
+		{
+			return std::any_of(TYPE_NAMES.begin(), TYPE_NAMES.end(), [type](const std::pair<const std::string, AircraftType>& name)
+			{
+				return static_cast<std::uint32_t>(name.second) == type;
+			});
+		}
+
+		bool readHeader(std::ifstream& file, Header& header)
+		{
+			return file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+				std::equal(MAGIC, MAGIC + 4, header.magic) && header.version == VERSION;
+		}
+	}
+
+	void compileLevel(const std::string & textPath, const std::string & binaryPath)
+	{
+		std::string text;
+		if (!readText(textPath, text))
+		{
+			throw std::runtime_error("Level load failed " + textPath);
+		}
+
+		std::istringstream in(text);
+
+		float length = 0.f;
+		std::vector<Record> records;
+
+		std::string line;
+		for (int lineNumber = 1; std::getline(in, line); ++lineNumber)
+		{
+			line = line.substr(0, line.find('#'));
+
+			std::istringstream tokens(line);
+			std::string keyword;
+			if (!(tokens >> keyword))
+				continue;
+
+			std::string error;
+			if (keyword == "length")
+			{
+				if (!(tokens >> length) || length <= 0.f)
+					error = "expected a positive length";
+			}
+			else if (keyword == "spawn")
+			{
+				std::string type;
+				Record record;
+
+				if (!(tokens >> type >> record.x >> record.distance))
+					error = "expected spawn <type> <x> <distance>";
+				else if (TYPE_NAMES.find(type) == TYPE_NAMES.end())
+					error = "unknown aircraft type " + type;
+				else
+				{
+					record.type = static_cast<std::uint32_t>(TYPE_NAMES.at(type));
+					records.push_back(record);
+				}
+			}
+			else
+			{
+				error = "unknown keyword " + keyword;
+			}
+
+			if (!error.empty())
+			{
+				throw std::runtime_error(textPath + "(" + std::to_string(lineNumber) + "): " + error);
+			}
+		}
+
+		if (length <= 0.f)
+		{
+			throw std::runtime_error(textPath + ": missing length");
+		}
+
+		std::stable_sort(records.begin(), records.end(), [](const Record& lhs, const Record& rhs)
+		{
+			return lhs.distance < rhs.distance;
+		});
+
+		Header header;
+		std::copy(MAGIC, MAGIC + 4, header.magic);
+		header.version = VERSION;
+		header.length = length;
+		header.count = static_cast<std::uint32_t>(records.size());
+		header.sourceHash = hashText(text);
+		header.sourceSize = static_cast<std::uint32_t>(text.size());
+
+		std::ofstream out(binaryPath, std::ios::binary | std::ios::trunc);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+
+		if (!out)
+		{
+			throw std::runtime_error("Level write failed " + binaryPath);
+		}
+	}
+
+	bool isLevelCurrent(const std::string & textPath, const std::string & binaryPath)
+	{
+		std::ifstream binary(binaryPath, std::ios::binary);
+		Header header;
+		if (!readHeader(binary, header))
+			return false;
+
+		//without the source there is nothing to be stale against
+		std::ifstream source(textPath, std::ios::binary | std::ios::ate);
+		if (!source)
+			return true;
+
+		//a different size is certainly an edit, only the same size needs the hash
+		if (static_cast<std::uint64_t>(source.tellg()) != header.sourceSize)
+			return false;
+
+		std::string text;
+		return readText(textPath, text) && hashText(text) == header.sourceHash;
+	}
+
+	LevelStream::LevelStream()
+		: file_()
+		, length_(0.f)
+		, count_(0)
+		, remaining_(0)
+		, window_()
+	{
+	}
+
+	bool LevelStream::open(const std::string & binaryPath)
+	{
+		file_.close();
+		file_.clear();
+		window_.clear();
+		count_ = 0;
+		remaining_ = 0;
+
+		file_.open(binaryPath, std::ios::binary);
+
+		Header header;
+		if (!readHeader(file_, header))
+		{
+			file_.close();
+			return false;
+		}
+
+		length_ = header.length;
+		count_ = header.count;
+		remaining_ = header.count;
+		return true;
+	}
+
+	float LevelStream::getLength() const
+	{
+		return length_;
+	}
+
+	bool LevelStream::hasNext()
+	{
+		if (window_.empty())
+			fill();
+
+		return !window_.empty();
+	}
+
+	const SpawnRecord & LevelStream::peek()
+	{
+		if (!hasNext())
+		{
+			throw std::runtime_error("Level has no more spawns");
+		}
+
+		return window_.front();
+	}
+
+	void LevelStream::pop()
+	{
+		if (hasNext())
+			window_.pop_front();
+	}
+
+	std::size_t LevelStream::tell() const
+	{
+		return count_ - remaining_ - window_.size();
+	}
+
+	void LevelStream::seek(std::size_t consumed)
+	{
+		consumed = std::min<std::size_t>(consumed, count_);
+
+		window_.clear();
+		file_.clear();
+		file_.seekg(sizeof(Header) + consumed * sizeof(Record));
+		remaining_ = count_ - static_cast<std::uint32_t>(consumed);
+	}
+
+	void LevelStream::fill()
+	{
+		Record block[BLOCK_SIZE];
+		std::size_t count = std::min<std::size_t>(remaining_, BLOCK_SIZE);
+
+		if (count == 0 || !file_.read(reinterpret_cast<char*>(block), count * sizeof(Record)))
+		{
+			remaining_ = 0;	//truncated file, stop rather than spawn garbage
+			return;
+		}
+
+		remaining_ -= static_cast<std::uint32_t>(count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (!isKnownType(block[i].type))
+			{
+				remaining_ = 0;	//corrupt record, stop the same way
+				return;
+			}
+			window_.push_back(SpawnRecord{ static_cast<AircraftType>(block[i].type), block[i].x, block[i].distance });
+		}
+	}
+}
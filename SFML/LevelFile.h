@@ -0,0 +1,80 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "Aircraft.h"
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+
+namespace GEX {
+
+	//one enemy, placed relative to where the player starts
+	struct SpawnRecord
+	{
+		AircraftType			type;
+		float					x;			//offset from the centre of the screen
+		float					distance;	//how far the player has scrolled when it appears
+	};
+
+	//turns an authored text level into the binary level LevelStream reads, spawns sorted by distance
+	//throws std::runtime_error naming the line on bad input
+	void						compileLevel(const std::string& textPath, const std::string& binaryPath);
+
+	//false if the binary level is missing, from an older format or compiled from different text
+	bool						isLevelCurrent(const std::string& textPath, const std::string& binaryPath);
+
+	//reads a binary level a block at a time, so only the next few spawns are ever in memory
+	class LevelStream
+	{
+	public:
+								LevelStream();
+
+		bool					open(const std::string& binaryPath);	//false if missing or not a level file
+		float					getLength() const;
+
+		bool					hasNext();
+		const SpawnRecord&		peek();		//next spawn in distance order, hasNext() must be true
+		void					pop();
+
+		std::size_t				tell() const;				//spawns consumed so far
+		void					seek(std::size_t consumed);	//rewind or skip to a tell() value
+
+	private:
+		void					fill();
+
+	private:
+		std::ifstream			file_;
+		float					length_;
+		std::uint32_t			count_;
+		std::uint32_t			remaining_;	//records still on disk
+		std::deque<SpawnRecord>	window_;
+	};
+}
@@ -37,9 +37,10 @@ MenuState::MenuState(GEX::StateStack & stack, State::Context context)
 	, options_()
 	, optionsIndex_(0)
 {
-	sf::Texture& texture = context.textures->get(GEX::TextureID::TitleScreen);
+	GEX::TextureRegion texture = context.textures->get(GEX::TextureID::TitleScreen);
 
-	backgroundSprite_.setTexture(texture);
+	backgroundSprite_.setTexture(*texture.texture);
+	backgroundSprite_.setTextureRect(texture.rect);
 
 	//set up menu
 	sf::Text playOption;
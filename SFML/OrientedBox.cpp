@@ -0,0 +1,86 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "OrientedBox.h"
+#include "Utility.h"
+#include <cmath>
+
+namespace GEX {
+
+	namespace
+	{
+		const float AXIS_ALIGNED_EPSILON = 1e-4f;	//sine of the largest angle still treated as a quarter turn
+
+		float dot(sf::Vector2f lhs, sf::Vector2f rhs)
+		{
+			return lhs.x * rhs.x + lhs.y * rhs.y;
+		}
+
+		//half the box's extent when projected onto axis
+		float projectedRadius(const OrientedBox& box, sf::Vector2f axis)
+		{
+			return box.halfSize.x * std::abs(dot(box.axes[0], axis))
+				+ box.halfSize.y * std::abs(dot(box.axes[1], axis));
+		}
+	}
+
+	OrientedBox OrientedBox::fromRect(const sf::Transform & transform, const sf::FloatRect & rect)
+	{
+		sf::Vector2f origin = transform.transformPoint(rect.left, rect.top);
+		sf::Vector2f side1 = transform.transformPoint(rect.left + rect.width, rect.top) - origin;
+		sf::Vector2f side2 = transform.transformPoint(rect.left, rect.top + rect.height) - origin;
+
+		OrientedBox box;
+		box.center = origin + (side1 + side2) / 2.f;
+		box.halfSize = sf::Vector2f(length(side1), length(side2)) / 2.f;
+
+		//a flattened rect keeps a usable axis so projections stay defined
+		box.axes[0] = box.halfSize.x > 0.f ? side1 / (2.f * box.halfSize.x) : sf::Vector2f(1.f, 0.f);
+		box.axes[1] = box.halfSize.y > 0.f ? side2 / (2.f * box.halfSize.y) : sf::Vector2f(-box.axes[0].y, box.axes[0].x);
+		box.isAxisAligned = std::abs(box.axes[0].x) < AXIS_ALIGNED_EPSILON
+			|| std::abs(box.axes[0].y) < AXIS_ALIGNED_EPSILON;
+
+		return box;
+	}
+
+	bool intersects(const OrientedBox & lhs, const OrientedBox & rhs)
+	{
+		//two rectangles only need their own four side normals checked
+		sf::Vector2f offset = rhs.center - lhs.center;
+		const sf::Vector2f axes[] = { lhs.axes[0], lhs.axes[1], rhs.axes[0], rhs.axes[1] };
+
+		for (sf::Vector2f axis : axes)
+		{
+			if (std::abs(dot(offset, axis)) >= projectedRadius(lhs, axis) + projectedRadius(rhs, axis))
+				return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,50 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <array>
+
+namespace GEX {
+
+	//a rectangle under rotation and scale, for when its axis-aligned bounds are too generous
+	struct OrientedBox
+	{
+		sf::Vector2f					center;
+		std::array<sf::Vector2f, 2>		axes;		//unit length, along the rectangle's sides
+		sf::Vector2f					halfSize;	//extent along each axis
+		bool							isAxisAligned;	//the transformed rect is already exact
+
+		static OrientedBox				fromRect(const sf::Transform& transform, const sf::FloatRect& rect);
+	};
+
+	bool								intersects(const OrientedBox& lhs, const OrientedBox& rhs);	//separating axis test, touching does not count
+}
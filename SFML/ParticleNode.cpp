@@ -30,32 +30,69 @@
 
 #include "ParticleNode.h"
 #include "DataTables.h"
+#include <algorithm>
 
 namespace GEX {
 
 	namespace
 	{
 		const std::map<GEX::Particle::Type, GEX::ParticleData> TABLE = initializeParticleData();
+
+		const float DEGRADE_START = 0.5f;	//share of the budget where emission starts to thin
+		const float MIN_ADMISSION = 0.25f;	//share of emitted particles still admitted at the budget
 	}
 
 	ParticleNode::ParticleNode(Particle::Type type, const GEX::TextureManager& textures)
 		: SceneNode()
-		, particles_()
+		, particles_(TABLE.at(type).budget)
+		, head_(0)
+		, count_(0)
 	    , texture_(textures.get(GEX::TextureID::Particle))
 	    , type_(type)
-	    , vertexArray_(sf::Quads)
+	    , emissionRate_(30.f)
+	    , budget_(TABLE.at(type).budget)
+	    , admission_(0.f)
+	    , counters_()
+	    , vertices_(TABLE.at(type).budget * 4)
+	    , vertexBuffer_()
 	    , needsVertexUpdate_(true)
 	{}
 
 	void ParticleNode::addParticle(sf::Vector2f position)
 	{
-		Particle particle;
-		particle.position = position;
+		if (budget_ == 0)
+		{
+			++counters_.dropped;
+			return;
+		}
 
+		//admit a falling share as the system fills, so busy scenes lose density rather than trails
+		float fill = static_cast<float>(count_) / budget_;
+		float share = 1.f - (1.f - MIN_ADMISSION) * (fill - DEGRADE_START) / (1.f - DEGRADE_START);
+		admission_ += std::min(1.f, std::max(MIN_ADMISSION, share));
+
+		if (admission_ < 1.f)
+		{
+			++counters_.dropped;
+			return;
+		}
+		admission_ -= 1.f;
+
+		//all particles of a type live as long, so the oldest is also the faintest
+		if (count_ == budget_)
+		{
+			removeOldest();
+			++counters_.evicted;
+		}
+
+		std::size_t slot = getSlot(count_++);
+		Particle& particle = particles_[slot];
+		particle.position = position;
 		particle.color = TABLE.at(type_).color;
 		particle.lifetime = TABLE.at(type_).lifetime;
 
-		particles_.push_back(particle);
+		writeQuad(slot);
+		++counters_.emitted;
 	}
 
 	Particle::Type ParticleNode::getParticleType() const
@@ -68,17 +105,66 @@ namespace GEX {
 		return Category::Type::ParticleSystem;
 	}
 
+	void ParticleNode::setEmissionRate(float rate)
+	{
+		emissionRate_ = rate;
+	}
+
+	float ParticleNode::getEmissionRate() const
+	{
+		return emissionRate_;
+	}
+
+	void ParticleNode::setBudget(std::size_t count)
+	{
+		if (count == budget_)
+			return;
+
+		while (count_ > count)
+		{
+			removeOldest();
+			++counters_.evicted;
+		}
+
+		//re-pack the survivors from slot 0 into rings of the new size
+		std::vector<Particle> particles(count);
+		for (std::size_t age = 0; age < count_; ++age)
+			particles[age] = particles_[getSlot(age)];
+
+		particles_.swap(particles);
+		head_ = 0;
+		budget_ = count;
+
+		vertices_.assign(count * 4, sf::Vertex());
+		for (std::size_t slot = 0; slot < count_; ++slot)
+			writeQuad(slot);
+
+		vertexBuffer_.reset();
+		needsVertexUpdate_ = true;
+	}
+
+	std::size_t ParticleNode::getParticleCount() const
+	{
+		return count_;
+	}
+
+	const ParticleNode::Counters & ParticleNode::getCounters() const
+	{
+		return counters_;
+	}
+
+	//stays on the main thread: the budgets cap aging and fading at about 15us a tick, less than a pool hand-off saves
 	void ParticleNode::updateCurrent(sf::Time dt, CommandQueue & commands)
 	{
 		// remove the aged out particles
-		while (!particles_.empty() && particles_.front().lifetime <= sf::Time::Zero)
+		while (count_ > 0 && particles_[head_].lifetime <= sf::Time::Zero)
 		{
-			particles_.pop_front();
+			removeOldest();
 		}
 		//take dt off particle lifetimes
-		for (Particle& p : particles_)
+		for (std::size_t age = 0; age < count_; ++age)
 		{
-			p.lifetime -= dt;
+			particles_[getSlot(age)].lifetime -= dt;
 		}
 
 		//mark for update
@@ -88,46 +174,89 @@ namespace GEX {
 
 	void ParticleNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
 	{
+		if (count_ == 0)
+			return;
+
+		if (sf::VertexBuffer::isAvailable() && !vertexBuffer_)
+		{
+			vertexBuffer_.reset(new sf::VertexBuffer(sf::Quads, sf::VertexBuffer::Stream));
+			vertexBuffer_->create(vertices_.size());
+			needsVertexUpdate_ = true;
+		}
+
 		if (needsVertexUpdate_)
 		{
-			computeVerticies();
+			updateAlpha();
+
+			//the live part of the ring, in at most two pieces
+			if (vertexBuffer_)
+			{
+				std::size_t first = std::min(count_, budget_ - head_);
+				vertexBuffer_->update(&vertices_[head_ * 4], first * 4, static_cast<unsigned int>(head_ * 4));
+				if (count_ > first)
+					vertexBuffer_->update(&vertices_[0], (count_ - first) * 4, 0);
+			}
 			needsVertexUpdate_ = false;
 		}
-		states.texture = &texture_;
+		states.texture = texture_.texture;
 
-		//draw all verticies
-		target.draw(vertexArray_, states);
+		//oldest first so newer particles draw on top
+		std::size_t first = std::min(count_, budget_ - head_);
+		drawRange(target, states, head_, first);
+		if (count_ > first)
+			drawRange(target, states, 0, count_ - first);
 	}
-	
-	void ParticleNode::addVertex(float worldX, float worldY, float texCoordU, float texCoordB, const sf::Color color) const
+
+	std::size_t ParticleNode::getSlot(std::size_t age) const
 	{
-		sf::Vertex vertex;
-		vertex.position = sf::Vector2f(worldX, worldY);
-		vertex.texCoords = sf::Vector2f(texCoordU, texCoordB);
-		vertex.color = color;
+		return (head_ + age) % budget_;
+	}
 
-		vertexArray_.append(vertex);
+	void ParticleNode::removeOldest()
+	{
+		head_ = (head_ + 1) % budget_;
+		--count_;
 	}
 
-	void ParticleNode::computeVerticies() const
+	void ParticleNode::writeQuad(std::size_t slot)
 	{
-		sf::Vector2f size(texture_.getSize());
+		const Particle& p = particles_[slot];
+
+		sf::Vector2f size(static_cast<float>(texture_.rect.width), static_cast<float>(texture_.rect.height));
 		sf::Vector2f half = size / 2.f;
-		vertexArray_.clear();
+		float left = static_cast<float>(texture_.rect.left);
+		float top = static_cast<float>(texture_.rect.top);
 
-		// Refill vertex array
-		for (const Particle& p : particles_)
-		{
-			sf::Vector2f position = p.position;
-			sf::Color color = p.color;
-			float ratio = p.lifetime.asSeconds() / TABLE.at(type_).lifetime.asSeconds();
+		sf::Vertex* quad = &vertices_[slot * 4];
+		quad[0] = sf::Vertex(sf::Vector2f(p.position.x - half.x, p.position.y - half.y), p.color, sf::Vector2f(left, top));
+		quad[1] = sf::Vertex(sf::Vector2f(p.position.x + half.x, p.position.y - half.y), p.color, sf::Vector2f(left + size.x, top));
+		quad[2] = sf::Vertex(sf::Vector2f(p.position.x + half.x, p.position.y + half.y), p.color, sf::Vector2f(left + size.x, top + size.y));
+		quad[3] = sf::Vertex(sf::Vector2f(p.position.x - half.x, p.position.y + half.y), p.color, sf::Vector2f(left, top + size.y));
+	}
 
-			color.a = static_cast<sf::Uint8> (255 * std::max(ratio, 0.f));
+	void ParticleNode::updateAlpha() const
+	{
+		const float lifetime = TABLE.at(type_).lifetime.asSeconds();
+
+		for (std::size_t age = 0; age < count_; ++age)
+		{
+			std::size_t slot = getSlot(age);
+			float ratio = particles_[slot].lifetime.asSeconds() / lifetime;
+			sf::Uint8 alpha = static_cast<sf::Uint8>(255 * std::max(ratio, 0.f));
 
-			addVertex(position.x - half.x, position.y - half.y, 0.f, 0.f, color);
-			addVertex(position.x + half.x, position.y - half.y, size.x, 0.f, color);
-			addVertex(position.x + half.x, position.y + half.y, size.x, size.y, color);
-			addVertex(position.x - half.x, position.y + half.y, 0.f, size.y, color);
+			sf::Vertex* quad = &vertices_[slot * 4];
+			quad[0].color.a = alpha;
+			quad[1].color.a = alpha;
+			quad[2].color.a = alpha;
+			quad[3].color.a = alpha;
 		}
 	}
-}
\ No newline at end of file
+
+	void ParticleNode::drawRange(sf::RenderTarget & target, sf::RenderStates states, std::size_t first, std::size_t count) const
+	{
+		if (vertexBuffer_)
+			target.draw(*vertexBuffer_, first * 4, count * 4, states);
+		else
+			target.draw(&vertices_[first * 4], count * 4, sf::Quads, states);
+	}
+}
@@ -30,33 +30,60 @@
 #pragma once
 #include "SceneNode.h"
 #include "Particle.h"
-#include <deque>
-#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 #include "TextureManager.h"
+#include <memory>
+#include <vector>
 
 namespace GEX {
 	class ParticleNode : public SceneNode
 	{
+	public:
+		//running totals since the node was built
+		struct Counters
+		{
+			std::size_t			emitted = 0;	//admitted into the system
+			std::size_t			dropped = 0;	//thinned out while the system was busy
+			std::size_t			evicted = 0;	//pushed out before their time by the budget
+		};
+
 	public:
 		ParticleNode(Particle::Type type, const GEX::TextureManager& textures);
 
-		void					addParticle(sf::Vector2f position);
+		void					addParticle(sf::Vector2f position);	//may be dropped or evict the oldest, see setBudget
 		Particle::Type			getParticleType() const;
 		unsigned int			getCategory() const override;
 
+		void					setEmissionRate(float rate);	//particles per second, read by emitters
+		float					getEmissionRate() const;
+		void					setBudget(std::size_t count);	//emission thins past half of it, the oldest and faintest go past it
+		std::size_t				getParticleCount() const;
+		const Counters&			getCounters() const;
+
 	private:
 		void					updateCurrent(sf::Time dt, CommandQueue& commands) override;
 		void					drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
-		void					addVertex(float worldX, float worldY, float texCoordU, float texCoordB, const sf::Color color) const;
-		void					computeVerticies() const;
+		std::size_t				getSlot(std::size_t age) const;	//0 is the oldest live particle
+		void					removeOldest();
+		void					writeQuad(std::size_t slot);	//once, when the particle is born
+		void					updateAlpha() const;
+		void					drawRange(sf::RenderTarget& target, sf::RenderStates states, std::size_t first, std::size_t count) const;
 
 	private:
-		std::deque<Particle>    particles_;
-		const sf::Texture&		texture_;
+		std::vector<Particle>	particles_;		//ring sized to the budget, oldest at head_
+		std::size_t				head_;
+		std::size_t				count_;
+		TextureRegion			texture_;
 		Particle::Type			type_;
-		mutable sf::VertexArray vertexArray_;
+		float					emissionRate_;
+		std::size_t				budget_;
+		float					admission_;		//carries fractional admissions over, keeps thinning even
+		Counters				counters_;
+		mutable std::vector<sf::Vertex>	vertices_;	//four per ring slot, after birth only alpha changes
+		mutable std::unique_ptr<sf::VertexBuffer>	vertexBuffer_;	//made on first draw, headless Worlds never touch the GPU
 		mutable bool			needsVertexUpdate_;
 	};
 
@@ -0,0 +1,50 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "Particle.h"
+#include "HandleTable.h"
+#include <array>
+
+namespace GEX {
+
+	class ParticleNode;
+
+	//the World's particle systems by type, so emitters find theirs without a command
+	class ParticleRegistry
+	{
+	public:
+		void					add(ParticleNode& system);	//one per type, replaces an earlier one
+		ParticleNode*			find(Particle::Type type) const;	//null if none or it is gone
+		Handle					getHandle(Particle::Type type) const;	//for emitters to keep, stale once the system goes
+
+	private:
+		std::array<Handle, static_cast<std::size_t>(Particle::Type::ParticleCount)>	systems_;
+	};
+}
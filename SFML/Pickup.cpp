@@ -30,18 +30,15 @@
 #include "Pickup.h"
 #include "DataTables.h"
 #include "Utility.h"
+#include <cassert>
 
 namespace GEX {
 
-	namespace
-	{
-		const std::map<Pickup::Type, PickupData>	TABLE = initializePickupData();
-	}
-
-	Pickup::Pickup(Type type, const TextureManager & textures)
+	Pickup::Pickup(Type type, const TextureManager & textures, const GameData& data)
 		: Entity(1)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
+		, data_(data.pickups.at(type))
+		, sprite_(*textures.get(data_.texture).texture, textures.get(data_.texture).map(data_.textureRect))
 	{
 		centerOrigin(sprite_);
 	}
@@ -51,14 +48,31 @@ namespace GEX {
 		return Category::Type::Pickup;
 
 	}
-	sf::FloatRect Pickup::getBoundingBox() const
+
+	Pickup::Type Pickup::getType() const
+	{
+		return type_;
+	}
+	sf::FloatRect Pickup::getLocalBounds() const
 	{
-		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
+		return sprite_.getGlobalBounds();
 	}
 	void Pickup::apply(Aircraft & player)
 	{
-		TABLE.at(type_).action(player);
+		data_.action(player, data_.value);
 	}
+	void Pickup::save(Snapshot & snapshot) const
+	{
+		Entity::save(snapshot);
+		snapshot.type = type_;
+	}
+
+	void Pickup::restore(const Snapshot & snapshot)
+	{
+		assert(snapshot.type == type_);
+		Entity::restore(snapshot);
+	}
+
 	void Pickup::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
 	{
 		target.draw(sprite_, states);
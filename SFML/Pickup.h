@@ -34,6 +34,9 @@
 
 namespace GEX {
 
+	struct GameData;
+	struct PickupData;
+
 	class Pickup : public Entity
 	{
 
@@ -47,18 +50,29 @@ namespace GEX {
 			Count
 		};
 	
-												Pickup(Type type, const TextureManager& textures);
+		struct Snapshot : Entity::Snapshot
+		{
+			Type								type;
+		};
+
+	public:
+												Pickup(Type type, const TextureManager& textures, const GameData& data);
 												~Pickup() = default;
 
 		unsigned int							getCategory() const override;
-		sf::FloatRect							getBoundingBox() const override;
+		Type									getType() const;
 		void									apply(Aircraft& player);
 
+		void									save(Snapshot& snapshot) const;
+		void									restore(const Snapshot& snapshot);
+
 	private:
 		void									drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
+		sf::FloatRect							getLocalBounds() const override;
 
 	private:
 		Type									type_;
+		const PickupData&						data_;
 		sf::Sprite								sprite_;
 	};
 }
@@ -54,7 +54,8 @@ namespace GEX {
 	{
 		MissionRunning,
 		MissionSuccess,
-		MissionFailure
+		MissionFailure,
+		MissionRetry		//rewind to the last checkpoint and keep playing
 	};
 
 	class PlayerControl
@@ -31,8 +31,24 @@
 
 namespace GEX
 {
+	namespace
+	{
+		//unit quad, scaled to the output size when drawn so it never needs rebuilding
+		sf::VertexArray createFullscreenQuad()
+		{
+			sf::VertexArray verticies(sf::TriangleStrip, 4);
+			verticies[0] = sf::Vertex(sf::Vector2f(0, 0), sf::Vector2f(0, 1));
+			verticies[1] = sf::Vertex(sf::Vector2f(1, 0), sf::Vector2f(1, 1));
+			verticies[2] = sf::Vertex(sf::Vector2f(0, 1), sf::Vector2f(0, 0));
+			verticies[3] = sf::Vertex(sf::Vector2f(1, 1), sf::Vector2f(1, 0));
+			return verticies;
+		}
+
+		const sf::VertexArray FULLSCREEN_QUAD = createFullscreenQuad();
+	}
 
-	PostEffect::PostEffect()
+	PostEffect::PostEffect(RenderTargetPool& renderTargets)
+		: renderTargets_(renderTargets)
 	{
 	}
 	
@@ -45,16 +61,16 @@ namespace GEX
 	{
 		sf::Vector2f outputSize = static_cast<sf::Vector2f>(output.getSize());
 
-		sf::VertexArray verticies(sf::TriangleStrip, 4);
-		verticies[0] = sf::Vertex(sf::Vector2f(0, 0), sf::Vector2f(0, 1));
-		verticies[1] = sf::Vertex(sf::Vector2f(outputSize.x, 0), sf::Vector2f(1, 1));
-		verticies[2] = sf::Vertex(sf::Vector2f(0, outputSize.y), sf::Vector2f(0, 0));
-		verticies[3] = sf::Vertex(sf::Vector2f(outputSize), sf::Vector2f(1, 0));
-
 		sf::RenderStates states;
 		states.shader = &shader;
 		states.blendMode = sf::BlendNone;
+		states.transform.scale(outputSize.x, outputSize.y);
 
-		output.draw(verticies, states);
+		output.draw(FULLSCREEN_QUAD, states);
+	}
+
+	RenderTargetPool & PostEffect::getRenderTargets() const
+	{
+		return renderTargets_;
 	}
 }
\ No newline at end of file
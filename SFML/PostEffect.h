@@ -33,13 +33,14 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include "RenderTargetPool.h"
 
 namespace GEX 
 {
 	class PostEffect
 	{
 	public:
-										PostEffect();
+		explicit						PostEffect(RenderTargetPool& renderTargets);
 		virtual							~PostEffect() = default;
 										PostEffect(PostEffect& pe) = delete;
 		PostEffect&						operator=(const PostEffect& pe) = delete;
@@ -49,6 +50,11 @@ namespace GEX
 
 	protected:
 		static void						applyShader(const sf::Shader & shader, sf::RenderTarget & output);
+
+		RenderTargetPool&				getRenderTargets() const;	//for the chain building the passes
+
+	private:
+		RenderTargetPool&				renderTargets_;
 	};
 
 }
\ No newline at end of file
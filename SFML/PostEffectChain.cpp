@@ -0,0 +1,126 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "PostEffectChain.h"
+#include <cassert>
+#include <stdexcept>
+
+namespace GEX
+{
+	PostEffectChain::PostEffectChain(RenderTargetPool & renderTargets)
+		: renderTargets_(renderTargets)
+		, steps_()
+		, slots_()
+	{
+		clear();
+	}
+
+	void PostEffectChain::clear()
+	{
+		steps_.clear();
+		slots_.assign(2, Slot{ 1, 0, nullptr });
+	}
+
+	PostEffectChain::Target PostEffectChain::addTarget(unsigned int divisor)
+	{
+		slots_.push_back(Slot{ divisor, 0, nullptr });
+		return slots_.size() - 1;
+	}
+
+	void PostEffectChain::addPass(std::initializer_list<Target> inputs, Target output, Pass pass)
+	{
+		if (inputs.size() > MAX_INPUTS || output == Source)
+			throw std::logic_error("PostEffectChain::addPass - bad inputs or output");
+
+		Step step;
+		step.inputs.fill(Source);
+		step.inputCount = 0;
+		for (Target input : inputs)
+		{
+			assert(input < slots_.size() && input != output && "a target cannot be read and written by one pass");
+			step.inputs[step.inputCount++] = input;
+			use(input);
+		}
+		step.output = output;
+		step.pass = std::move(pass);
+
+		use(output);
+		steps_.push_back(std::move(step));
+	}
+
+	void PostEffectChain::use(Target target)
+	{
+		//called while the step is being added, so its index is the current size
+		slots_[target].lastUse = steps_.size();
+	}
+
+	void PostEffectChain::apply(const sf::RenderTexture & source, sf::RenderTarget & output)
+	{
+		sf::Vector2u size = source.getSize();
+
+		for (std::size_t i = 0; i < steps_.size(); ++i)
+		{
+			const Step& step = steps_[i];
+
+			Inputs inputs;
+			inputs.fill(nullptr);
+			for (std::size_t input = 0; input < step.inputCount; ++input)
+			{
+				Target target = step.inputs[input];
+				inputs[input] = target == Source ? &source : slots_[target].texture;
+				assert(inputs[input] && "read before written");
+			}
+
+			if (step.output == Output)
+			{
+				step.pass(inputs, output);
+			}
+			else
+			{
+				Slot& slot = slots_[step.output];
+				if (!slot.texture)
+					slot.texture = &renderTargets_.acquire(size / slot.divisor);
+
+				step.pass(inputs, *slot.texture);
+				slot.texture->display();
+			}
+
+			//hand back everything this step was the last to touch
+			for (std::size_t target = Output + 1; target < slots_.size(); ++target)
+			{
+				Slot& slot = slots_[target];
+				if (slot.texture && slot.lastUse == i)
+				{
+					renderTargets_.release(*slot.texture);
+					slot.texture = nullptr;
+				}
+			}
+		}
+	}
+}
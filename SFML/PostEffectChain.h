@@ -0,0 +1,89 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <array>
+#include <functional>
+#include <vector>
+#include "RenderTargetPool.h"
+
+namespace GEX
+{
+	//passes that name the targets they read and write, the chain borrows each target from the pool
+	//at its first write and hands it back after its last read
+	class PostEffectChain
+	{
+	public:
+		using Target = std::size_t;
+
+		static const Target								Source = 0;		//the texture the chain is applied to
+		static const Target								Output = 1;		//where the last pass draws
+		static const std::size_t						MAX_INPUTS = 2;
+
+		using Inputs = std::array<const sf::RenderTexture*, MAX_INPUTS>;
+		using Pass = std::function<void(const Inputs& inputs, sf::RenderTarget& output)>;
+
+	public:
+		explicit										PostEffectChain(RenderTargetPool& renderTargets);
+														PostEffectChain(const PostEffectChain&) = delete;
+		PostEffectChain&								operator=(const PostEffectChain&) = delete;
+
+		void											clear();
+		Target											addTarget(unsigned int divisor = 1);	//sized source / divisor
+		void											addPass(std::initializer_list<Target> inputs, Target output, Pass pass);
+
+		void											apply(const sf::RenderTexture& source, sf::RenderTarget& output);
+
+	private:
+		struct Step
+		{
+			std::array<Target, MAX_INPUTS>				inputs;
+			std::size_t									inputCount;
+			Target										output;
+			Pass										pass;
+		};
+
+		struct Slot
+		{
+			unsigned int								divisor;
+			std::size_t									lastUse;	//index of the last step touching it
+			sf::RenderTexture*							texture;	//borrowed while live, null otherwise
+		};
+
+	private:
+		void											use(Target target);
+
+	private:
+		RenderTargetPool&								renderTargets_;
+		std::vector<Step>								steps_;
+		std::vector<Slot>								slots_;		//Source and Output have entries but are never pooled
+	};
+}
@@ -33,32 +33,29 @@
 #include "Utility.h"
 #include "Category.h"
 #include "EmitterNode.h"
+#include <cassert>
 #include <iostream>
 
 
 namespace GEX {
 
-	namespace
-	{
-		const std::map<GEX::Projectile::Type, GEX::ProjectileData> TABLE = initializeProjectileData();
-	}
-
-
-	Projectile::Projectile(Type type, const TextureManager & textures)
+	Projectile::Projectile(Type type, const TextureManager & textures, const GameData& data,
+							const ParticleRegistry& particleSystems)
 		: Entity(1)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
+		, data_(data.projectiles.at(type))
+		, sprite_(*textures.get(data_.texture).texture, textures.get(data_.texture).map(data_.textureRect))
 	{
 		centerOrigin(sprite_);
 
 		if (isGuided())
 		{
-			std::unique_ptr<EmitterNode> smoke(new EmitterNode(Particle::Type::Smoke));
-			smoke->setPosition(0.f, Projectile::getBoundingBox().height / 2.f);
+			std::unique_ptr<EmitterNode> smoke(new EmitterNode(Particle::Type::Smoke, particleSystems));
+			smoke->setPosition(0.f, Projectile::getLocalBounds().height / 2.f);
 			attachChild(std::move(smoke));
 
-			std::unique_ptr<EmitterNode> fire(new EmitterNode(Particle::Type::Propellant));
-			fire->setPosition(0.f, Projectile::getBoundingBox().height / 2.f);
+			std::unique_ptr<EmitterNode> fire(new EmitterNode(Particle::Type::Propellant, particleSystems));
+			fire->setPosition(0.f, Projectile::getLocalBounds().height / 2.f);
 			attachChild(std::move(fire));
 
 			 
@@ -73,19 +70,19 @@ namespace GEX {
 			return Category::AlliedProjectile;
 	}
 
-	sf::FloatRect Projectile::getBoundingBox() const
+	sf::FloatRect Projectile::getLocalBounds() const
 	{
-		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
+		return sprite_.getGlobalBounds();
 	}
 
 	float Projectile::getMaxSpeed() const
 	{
-		return TABLE.at(type_).speed;
+		return data_.speed;
 	}
 
 	int Projectile::getDamage() const
 	{
-		return TABLE.at(type_).damage;
+		return data_.damage;
 	}
 
 	bool Projectile::isGuided() const
@@ -99,6 +96,21 @@ namespace GEX {
 		targetDirection_ = unitVector(position - getWorldPosition());
 	}
 
+	void Projectile::save(Snapshot & snapshot) const
+	{
+		Entity::save(snapshot);
+		snapshot.type = type_;
+		snapshot.targetDirection = targetDirection_;
+	}
+
+	void Projectile::restore(const Snapshot & snapshot)
+	{
+		assert(snapshot.type == type_);
+
+		Entity::restore(snapshot);
+		targetDirection_ = snapshot.targetDirection;
+	}
+
 	void Projectile::updateCurrent(sf::Time dt, CommandQueue& commands)
 	{
 		if (isGuided())
@@ -34,6 +34,11 @@
 #include "CommandQueue.h"
 
 namespace GEX {
+
+	struct GameData;
+	class ParticleRegistry;
+	struct ProjectileData;
+
 	class Projectile : public Entity
 	{
 	public:
@@ -44,23 +49,34 @@ namespace GEX {
 			Missile
 		};
 
+		struct Snapshot : Entity::Snapshot
+		{
+			Type				type;
+			sf::Vector2f		targetDirection;
+		};
+
 	public:
-							   Projectile(Type type, const TextureManager& textures);
+							   Projectile(Type type, const TextureManager& textures, const GameData& data,
+										   const ParticleRegistry& particleSystems);
 
 		unsigned int		   getCategory() const override;
-		sf::FloatRect		   getBoundingBox() const override;
 
 		float				   getMaxSpeed() const;
 		int					   getDamage() const;
 		bool				   isGuided() const;
 		void				   guidedTowards(sf::Vector2f position);
 
+		void				   save(Snapshot& snapshot) const;
+		void				   restore(const Snapshot& snapshot);
+
 	private:
 		void				   updateCurrent(sf::Time dt, CommandQueue& comands) override;
 		void				   drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		sf::FloatRect		   getLocalBounds() const override;
 
 	private:
 		Type				type_;
+		const ProjectileData&	data_;
 		sf::Sprite			sprite_;
 		sf::Vector2f		targetDirection_;  //used for missiles
 	};
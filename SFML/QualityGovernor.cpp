@@ -0,0 +1,104 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "QualityGovernor.h"
+#include <cassert>
+
+namespace GEX {
+
+	namespace
+	{
+		const float	STEP_DOWN_RATIO = 1.1f;		//average above 110% of budget sheds load
+		const float	STEP_UP_RATIO = 0.7f;		//average below 70% of budget restores it
+	}
+
+	QualityGovernor::QualityGovernor(sf::Time frameBudget, std::size_t windowSize)
+		: frameBudget_(frameBudget)
+		, frameTimes_(windowSize)
+		, next_(0)
+		, count_(0)
+		, total_(sf::Time::Zero)
+		, tier_(QualityTier::High)
+	{
+		assert(windowSize > 0);
+	}
+
+	void QualityGovernor::addFrame(sf::Time frameTime)
+	{
+		if (count_ == frameTimes_.size())
+			total_ -= frameTimes_[next_];
+		else
+			++count_;
+
+		frameTimes_[next_] = frameTime;
+		total_ += frameTime;
+		next_ = (next_ + 1) % frameTimes_.size();
+
+		//only decide on a full window of frames measured at the current tier
+		if (count_ < frameTimes_.size())
+			return;
+
+		sf::Time average = getAverageFrameTime();
+
+		if (average > frameBudget_ * STEP_DOWN_RATIO && tier_ != QualityTier::Low)
+		{
+			setTier(static_cast<QualityTier>(static_cast<int>(tier_) - 1));
+		}
+		else if (average < frameBudget_ * STEP_UP_RATIO && tier_ != QualityTier::High)
+		{
+			setTier(static_cast<QualityTier>(static_cast<int>(tier_) + 1));
+		}
+	}
+
+	QualityTier QualityGovernor::getTier() const
+	{
+		return tier_;
+	}
+
+	void QualityGovernor::setTier(QualityTier tier)
+	{
+		tier_ = tier;
+		resetWindow();
+	}
+
+	sf::Time QualityGovernor::getAverageFrameTime() const
+	{
+		if (count_ == 0)
+			return sf::Time::Zero;
+
+		return total_ / static_cast<float>(count_);
+	}
+
+	void QualityGovernor::resetWindow()
+	{
+		next_ = 0;
+		count_ = 0;
+		total_ = sf::Time::Zero;
+	}
+}
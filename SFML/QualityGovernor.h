@@ -0,0 +1,65 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/System/Time.hpp>
+#include <vector>
+
+namespace GEX {
+
+	enum class QualityTier {	//ordered lowest to highest
+		Low,
+		Medium,
+		High
+	};
+
+	//watches rolling frame times and steps the quality tier down under load, up with headroom
+	class QualityGovernor
+	{
+	public:
+		explicit					QualityGovernor(sf::Time frameBudget = sf::seconds(1.f / 60.f), std::size_t windowSize = 60);
+
+		void						addFrame(sf::Time frameTime);	//feed one measured (or injected) frame time
+
+		QualityTier					getTier() const;
+		void						setTier(QualityTier tier);	//force a tier and restart the window
+		sf::Time					getAverageFrameTime() const;
+
+	private:
+		void						resetWindow();
+
+	private:
+		sf::Time					frameBudget_;
+		std::vector<sf::Time>		frameTimes_;	//ring buffer of the last windowSize frames
+		std::size_t					next_;
+		std::size_t					count_;
+		sf::Time					total_;
+		QualityTier					tier_;
+	};
+}
@@ -0,0 +1,71 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "RenderTargetPool.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace GEX
+{
+	RenderTargetPool::RenderTargetPool()
+		: targets_()
+		, available_()
+	{
+	}
+
+	sf::RenderTexture & RenderTargetPool::acquire(sf::Vector2u size)
+	{
+		Key key(std::max(size.x, 1u), std::max(size.y, 1u));
+
+		auto found = available_.find(key);
+		if (found != available_.end())
+		{
+			sf::RenderTexture* target = found->second;
+			available_.erase(found);
+
+			//the last borrower may have left a scrolled view, passes draw in pixel coordinates
+			target->setView(target->getDefaultView());
+			return *target;
+		}
+
+		std::unique_ptr<sf::RenderTexture> target(new sf::RenderTexture());
+		if (!target->create(key.first, key.second))
+			throw std::runtime_error("RenderTargetPool::acquire - Failed to create render texture");
+		target->setSmooth(true);
+
+		targets_.push_back(std::move(target));
+		return *targets_.back();
+	}
+
+	void RenderTargetPool::release(sf::RenderTexture & target)
+	{
+		sf::Vector2u size = target.getSize();
+		available_.insert(std::make_pair(Key(size.x, size.y), &target));
+	}
+}
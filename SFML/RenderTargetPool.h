@@ -0,0 +1,57 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace GEX
+{
+	//size-keyed render textures shared by every post effect and World
+	class RenderTargetPool
+	{
+	public:
+														RenderTargetPool();
+														RenderTargetPool(const RenderTargetPool&) = delete;
+		RenderTargetPool&								operator=(const RenderTargetPool&) = delete;
+
+														//borrow a smoothed target of exactly this size, with its default view
+		sf::RenderTexture&								acquire(sf::Vector2u size);
+		void											release(sf::RenderTexture& target);	//hand it back for reuse
+
+	private:
+		typedef std::pair<unsigned int, unsigned int>	Key;
+
+		std::vector<std::unique_ptr<sf::RenderTexture>>	targets_;	//owns every target ever created
+		std::multimap<Key, sf::RenderTexture*>			available_;
+	};
+}
@@ -37,6 +37,7 @@
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <algorithm>
+#include <cmath>
 
 namespace GEX {
 	using Ptr = std::unique_ptr<SceneNode>;
@@ -45,7 +46,21 @@ namespace GEX {
 		: children_()
 		, parent_(nullptr)
 		, category_(category)
+		, handle_()
+		, previousPosition_()
+		, previousRotation_(0.f)
+		, hasPrevious_(false)
+		, renderTransform_()
+		, tickInterval_(1)
+		, skippedTicks_(0)
+		, skippedTime_(sf::Time::Zero)
 	{
+		handle_ = getHandleTable().insert(this);
+	}
+
+	SceneNode::~SceneNode()
+	{
+		getHandleTable().remove(handle_);
 	}
 
 	void SceneNode::attachChild(Ptr child)
@@ -123,28 +138,6 @@ namespace GEX {
 		return category_;
 	}
 
-	void SceneNode::checkSceneCollision(SceneNode & rootNode, std::set<Pair>& collisionPair)
-	{
-		checkNodeCollision(rootNode, collisionPair);
-		for (Ptr& c : rootNode.children_)
-		{
-			checkSceneCollision(*c, collisionPair);
-		}
-	}
-
-	void SceneNode::checkNodeCollision(SceneNode & node, std::set<Pair>& collisionPair)
-	{
-		if (this != &node && collision(*this, node) && !isDestroyed() && !node.isDestroyed())
-		{
-			collisionPair.insert(std::minmax(this, &node));
-		}
-
-		for (Ptr& c : children_)
-		{
-			c->checkNodeCollision(node, collisionPair);
-		}
-	}
-
 	bool SceneNode::isDestroyed() const
 	{
 		return false;
@@ -178,14 +171,99 @@ namespace GEX {
 
 	void SceneNode::update(sf::Time dt, CommandQueue& commands)
 	{
+		if (tickInterval_ == 0)
+			return;
+
+		if (tickInterval_ > 1 && ++skippedTicks_ < tickInterval_)
+		{
+			skippedTime_ += dt;
+			return;
+		}
+
+		dt += skippedTime_;
+		skippedTicks_ = 0;
+		skippedTime_ = sf::Time::Zero;
+
 		updateCurrent(dt, commands);
 		updateChildren(dt, commands);
 	}
 
 
+	void SceneNode::setTickInterval(unsigned int ticks)
+	{
+		if (ticks == tickInterval_)
+			return;
+
+		//sleeping nodes are frozen, not behind
+		if (ticks == 0)
+		{
+			skippedTicks_ = 0;
+			skippedTime_ = sf::Time::Zero;
+		}
+
+		tickInterval_ = ticks;
+	}
+
+	unsigned int SceneNode::getTickInterval() const
+	{
+		return tickInterval_;
+	}
+
+	sf::Time SceneNode::getOwedTime() const
+	{
+		return skippedTime_;
+	}
+
+	Handle SceneNode::getHandle() const
+	{
+		return handle_;
+	}
+
+	HandleTable<SceneNode>& SceneNode::getHandleTable()
+	{
+		//one per thread, batch Worlds build and destroy their nodes on a single worker
+		static thread_local HandleTable<SceneNode> table;
+		return table;
+	}
+
+	void SceneNode::saveTransform()
+	{
+		previousPosition_ = getPosition();
+		previousRotation_ = getRotation();
+		hasPrevious_ = true;
+
+		for (Ptr& child : children_)
+		{
+			child->saveTransform();
+		}
+	}
+
+	void SceneNode::interpolate(float alpha)
+	{
+		if (hasPrevious_)
+		{
+			//shortest way round, so 350 -> 10 turns through 0
+			float turn = std::fmod(getRotation() - previousRotation_ + 540.f, 360.f) - 180.f;
+
+			sf::Transformable blended = *this;
+			blended.setPosition(previousPosition_ + (getPosition() - previousPosition_) * alpha);
+			blended.setRotation(previousRotation_ + turn * alpha);
+			renderTransform_ = blended.getTransform();
+		}
+		else
+		{
+			renderTransform_ = getTransform();
+		}
+
+		for (Ptr& child : children_)
+		{
+			child->interpolate(alpha);
+		}
+	}
+
 	void SceneNode::draw(sf::RenderTarget & target, sf::RenderStates states) const
 	{
-		states.transform *= getTransform();
+		states.transform *= renderTransform_;	//set by interpolate()
 
 		drawCurrent(target, states);
 		drawChildren(target, states);
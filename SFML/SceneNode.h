@@ -35,7 +35,9 @@
 #include <memory>
 #include "Category.h"
 #include "Utility.h"
-#include <set>
+#include "HandleTable.h"
+#include <algorithm>
+#include <cassert>
 
 
 namespace GEX
@@ -52,7 +54,7 @@ namespace GEX
 
 	public:
 									SceneNode(Category::Type category = Category::Type::None);
-		virtual						~SceneNode() = default;
+		virtual						~SceneNode();
 									SceneNode(const SceneNode&) = delete;
 		SceneNode&					operator=(SceneNode&) = delete;
 
@@ -68,18 +70,37 @@ namespace GEX
 		void						onCommand(const Command& command, sf::Time dt);//Command current node, if category matches, and command children
 		virtual unsigned int		getCategory() const;	//return category
 
-		void						checkSceneCollision(SceneNode& rootNode, std::set<Pair>& collisionPair);
-		void						checkNodeCollision(SceneNode& node, std::set<Pair>& collisionPair); //See if nodes are colliding
 
 		virtual bool			    isDestroyed() const;
 		virtual bool				isMarkedForRemoval() const;
 
 		void						removeWrecks();
 
+		template <typename Function>
+		void						forEachChild(Function function);		//direct children only
+		template <typename Function>
+		void						forEachChild(Function function) const;
+		template <typename Predicate>
+		void						detachChildrenIf(Predicate predicate);	//destroys the detached children
+
+									//nodes register on construction, handles only resolve on the thread that built the node
+		Handle						getHandle() const;
+		template <typename T = SceneNode>
+		static T*					resolve(Handle handle);			//null once the node is destroyed
+
+		void						saveTransform();				//remember position and rotation at the start of a tick
+		void						interpolate(float alpha);		//blend saved and current transforms for drawing
+
+									//1 updates every tick, n every nth tick with the skipped time folded in, 0 sleeps.
+									//Going back to 1 hands the node everything it missed on its next update
+		void						setTickInterval(unsigned int ticks);
+		unsigned int				getTickInterval() const;
+
 	protected:
 		//update the tree
 		virtual void				updateCurrent(sf::Time dt, CommandQueue& comands);
 		void						updateChildren(sf::Time dt, CommandQueue& commands);
+		sf::Time					getOwedTime() const;	//skipped so far, handed over on the next update
 
 	private:
 		//draw the tree
@@ -88,12 +109,59 @@ namespace GEX
 		void						drawChildren(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+	private:
+		static HandleTable<SceneNode>&	getHandleTable();
+
 	private:
 		SceneNode *					parent_;
 		std::vector<Ptr>			children_;  //vector of unique pointers to SceneNodes 
 		Category::Type				category_;
+		Handle						handle_;
+
+		sf::Vector2f				previousPosition_;
+		float						previousRotation_;
+		bool						hasPrevious_;		//false until the first saveTransform, nodes spawned mid tick draw where they are
+		sf::Transform				renderTransform_;
+
+		unsigned int				tickInterval_;
+		unsigned int				skippedTicks_;
+		sf::Time					skippedTime_;		//owed to the node when it next updates
 	};
 
+	template <typename Function>
+	void SceneNode::forEachChild(Function function)
+	{
+		for (Ptr& child : children_)
+		{
+			function(*child);
+		}
+	}
+
+	template <typename Function>
+	void SceneNode::forEachChild(Function function) const
+	{
+		for (const Ptr& child : children_)
+		{
+			function(static_cast<const SceneNode&>(*child));
+		}
+	}
+
+	template <typename T>
+	T* SceneNode::resolve(Handle handle)
+	{
+		SceneNode* node = getHandleTable().resolve(handle);
+		assert(node == nullptr || dynamic_cast<T*>(node) != nullptr);
+
+		return static_cast<T*>(node);
+	}
+
+	template <typename Predicate>
+	void SceneNode::detachChildrenIf(Predicate predicate)
+	{
+		children_.erase(std::remove_if(children_.begin(), children_.end(),
+			[&](Ptr& child) { return predicate(*child); }), children_.end());
+	}
+
 	float distance(const SceneNode& lhs, const SceneNode& rhs);
 
 	bool collision(const SceneNode& lhs, const SceneNode& rhs); //check if bounding box of rects are intersecting 
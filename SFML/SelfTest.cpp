@@ -0,0 +1,173 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "SelfTest.h"
+#include "OrientedBox.h"
+#include "RenderTargetPool.h"
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <iostream>
+#include <random>
+
+namespace GEX {
+
+	namespace
+	{
+		const std::size_t	GRID_STEPS = 128;		//samples per side of the sampled box
+		const float			MARGIN = 0.5f;			//more than half a grid diagonal of the largest grown box
+		const float			MIN_SIDE = 8.f;			//stays positive after shrinking by the margin
+		const float			MAX_SIDE = 40.f;
+		const float			SPREAD = 60.f;			//centres land close enough for about half to overlap
+		const std::size_t	REPORTED = 10;
+
+		const sf::Vector2u	POOLED_SIZE(16, 16);
+		const sf::FloatRect	SCROLLED_VIEW(300.f, -2000.f, 16.f, 16.f);	//far from the pixel rect, as World leaves it
+
+		struct Box
+		{
+			sf::Transform		transform;
+			sf::FloatRect		rect;
+		};
+
+		sf::FloatRect grow(const sf::FloatRect& rect, float margin)
+		{
+			return sf::FloatRect(rect.left - margin, rect.top - margin, rect.width + 2.f * margin, rect.height + 2.f * margin);
+		}
+
+		//true if some grid point of lhs lies inside rhs, found without the box's own axes or extents
+		bool isSampledOverlap(const Box& lhs, const Box& rhs)
+		{
+			sf::Transform toRhs = rhs.transform.getInverse();
+			for (std::size_t i = 0; i <= GRID_STEPS; ++i)
+			{
+				for (std::size_t j = 0; j <= GRID_STEPS; ++j)
+				{
+					sf::Vector2f local(lhs.rect.left + lhs.rect.width * i / GRID_STEPS, lhs.rect.top + lhs.rect.height * j / GRID_STEPS);
+					if (rhs.rect.contains(toRhs.transformPoint(lhs.transform.transformPoint(local))))
+						return true;
+				}
+			}
+
+			return false;
+		}
+
+		Box resized(const Box& box, float margin)
+		{
+			return Box{ box.transform, grow(box.rect, margin) };
+		}
+	}
+
+	std::size_t checkOrientedBoxes(std::size_t pairs, unsigned int seed)
+	{
+		std::mt19937 random(seed);
+		std::uniform_real_distribution<float> position(-SPREAD / 2.f, SPREAD / 2.f);
+		std::uniform_real_distribution<float> side(MIN_SIDE, MAX_SIDE);
+		std::uniform_real_distribution<float> angle(0.f, 360.f);
+		std::uniform_int_distribution<int> quarterTurn(0, 3);
+
+		auto randomBox = [&]() {
+			Box box;
+			box.transform.translate(position(random), position(random));
+			//a quarter of the boxes take the axis-aligned shortcut
+			box.transform.rotate(quarterTurn(random) == 0 ? 90.f * quarterTurn(random) : angle(random));
+			float width = side(random);
+			float height = side(random);
+			box.rect = sf::FloatRect(-width / 2.f, -height / 2.f, width, height);
+			return box;
+		};
+
+		std::size_t mismatches = 0;
+		for (std::size_t pair = 0; pair < pairs; ++pair)
+		{
+			Box lhs = randomBox();
+			Box rhs = randomBox();
+			bool isHit = intersects(OrientedBox::fromRect(lhs.transform, lhs.rect), OrientedBox::fromRect(rhs.transform, rhs.rect));
+
+			//sampling is only exact away from the edges: shrunk boxes that still share a point must
+			//intersect, and grown boxes that share no grid point cannot
+			bool isWrong = isHit
+				? !isSampledOverlap(resized(lhs, MARGIN), resized(rhs, MARGIN))
+				: isSampledOverlap(resized(lhs, -MARGIN), resized(rhs, -MARGIN));
+
+			if (isWrong && ++mismatches <= REPORTED)
+			{
+				std::cout << "oriented boxes: pair " << pair << " of seed " << seed << " reported "
+					<< (isHit ? "a hit" : "a miss") << " that sampling contradicts" << std::endl;
+			}
+		}
+
+		return mismatches;
+	}
+
+	std::size_t checkRenderTargetPool()
+	{
+		RenderTargetPool pool;
+
+		sf::RenderTexture& scene = pool.acquire(POOLED_SIZE);
+		scene.setView(sf::View(SCROLLED_VIEW));
+		pool.release(scene);
+
+		sf::RenderTexture& pass = pool.acquire(POOLED_SIZE);
+		if (&pass != &scene)
+		{
+			std::cout << "render target pool: a released target was not reused" << std::endl;
+			return 1;
+		}
+
+		//the unit quad scaled to the output size, drawn the way PostEffect::applyShader draws it
+		sf::VertexArray quad(sf::TriangleStrip, 4);
+		quad[0] = sf::Vertex(sf::Vector2f(0.f, 0.f), sf::Color::White);
+		quad[1] = sf::Vertex(sf::Vector2f(1.f, 0.f), sf::Color::White);
+		quad[2] = sf::Vertex(sf::Vector2f(0.f, 1.f), sf::Color::White);
+		quad[3] = sf::Vertex(sf::Vector2f(1.f, 1.f), sf::Color::White);
+
+		sf::RenderStates states;
+		states.blendMode = sf::BlendNone;
+		states.transform.scale(static_cast<float>(POOLED_SIZE.x), static_cast<float>(POOLED_SIZE.y));
+
+		pass.clear(sf::Color::Black);
+		pass.draw(quad, states);
+		pass.display();
+
+		sf::Image image = pass.getTexture().copyToImage();
+		std::size_t mismatches = 0;
+		for (unsigned int y = 0; y < POOLED_SIZE.y; ++y)
+		{
+			for (unsigned int x = 0; x < POOLED_SIZE.x; ++x)
+			{
+				if (image.getPixel(x, y) != sf::Color::White && ++mismatches <= REPORTED)
+					std::cout << "render target pool: pixel " << x << "," << y << " missed by the fullscreen pass" << std::endl;
+			}
+		}
+		pool.release(pass);
+
+		return mismatches;
+	}
+}
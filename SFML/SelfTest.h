@@ -26,26 +26,14 @@
 * I certify that this work is solely my own and complies with
 * NBCC Academic Integrity Policy (policy 1111)
 */
-
 #pragma once
-#include "SceneNode.h"
-#include "SoundPlayer.h"
-#include <SFML/System/Vector2.hpp>
+#include <cstddef>
 
 namespace GEX {
 
-	class SoundPlayer;
-
-	class SoundNode : public SceneNode
-	{
-	public:
-		explicit					SoundNode(SoundPlayer& player);
-
-		void						playSound(SoundEffectID sound, sf::Vector2f position);
-		unsigned int				getCategory() const override;
-
-	private:
-		SoundPlayer &				sounds_;
-	};
+	//checks of code that is easy to get subtly wrong, run with --selftest
+	//each returns the number of mismatches and prints the first few
 
-}
\ No newline at end of file
+	std::size_t							checkOrientedBoxes(std::size_t pairs, unsigned int seed);	//separating axis test against point sampling
+	std::size_t							checkRenderTargetPool();	//a reused target still fills with a fullscreen pass after a view change
+}
@@ -28,11 +28,115 @@
 */
 
 #include "Application.h"
+#include "BatchSimulator.h"
+#include "SelfTest.h"
+#include "StressBenchmark.h"
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
 
-int main()
+int main(int argc, char* argv[])
 {
+	//SFML --batch [sweep] [results.csv]: headless balance runs instead of the game
+	if (argc > 1 && std::string(argv[1]) == "--batch")
+	{
+		std::string sweep = argc > 2 ? argv[2] : "Media/Balance/Sweep.txt";
+		std::string results = argc > 3 ? argv[3] : "balance.csv";
 
-	Application app;
+		try
+		{
+			GEX::ThreadPool threads;
+			GEX::BatchSimulator simulator(threads);
+			simulator.loadSweep(sweep);
+			simulator.simulate();
+			simulator.writeResults(results);
+			simulator.writeSummary(results.substr(0, results.rfind('.')) + "_summary.csv");
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << e.what() << std::endl;
+			return 1;
+		}
+		return 0;
+	}
+
+	//SFML --bench [results.csv] [max entities] [ticks] [default|homing] [threads]: World::update cost from 10 entities up,
+	//more than one thread also reruns each point with hit responses on a pool and checks the outcome matches
+	if (argc > 1 && std::string(argv[1]) == "--bench")
+	{
+		std::string results = argc > 2 ? argv[2] : "bench.csv";
+		std::size_t maxEntities = argc > 3 ? std::stoul(argv[3]) : 100000;
+		std::size_t ticks = argc > 4 ? std::stoul(argv[4]) : 120;
+		std::string mix = argc > 5 ? argv[5] : "default";
+		std::size_t threadCount = argc > 6 ? std::stoul(argv[6]) : 1;
+
+		try
+		{
+			std::unique_ptr<GEX::ThreadPool> threads;
+			GEX::StressBenchmark benchmark(ticks);
+			if (threadCount > 1)
+			{
+				threads.reset(new GEX::ThreadPool(threadCount));
+				benchmark.setThreadPool(threads.get());
+			}
+			if (mix == "homing")
+				benchmark.setMix(GEX::StressBenchmark::Mix::homing());
+			else if (mix != "default")
+				throw std::runtime_error("Unknown benchmark mix " + mix);
+			benchmark.addSweep(10, maxEntities);
+			benchmark.run();
+			benchmark.writeResults(results);
+
+			if (!benchmark.isPooledConsistent())
+				return 1;
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << e.what() << std::endl;
+			return 1;
+		}
+		return 0;
+	}
+
+	//SFML --selftest [pairs] [seed]: randomized checks against brute force and a pooled render pass, nonzero exit on any mismatch
+	if (argc > 1 && std::string(argv[1]) == "--selftest")
+	{
+		std::size_t pairs = argc > 2 ? std::stoul(argv[2]) : 10000;
+		unsigned int seed = argc > 3 ? static_cast<unsigned int>(std::stoul(argv[3])) : 5489u;
+
+		std::size_t boxMismatches = GEX::checkOrientedBoxes(pairs, seed);
+		std::cout << "oriented boxes: " << boxMismatches << " mismatches in " << pairs << " pairs" << std::endl;
+
+		std::size_t poolMismatches = 0;
+		try
+		{
+			poolMismatches = GEX::checkRenderTargetPool();
+			std::cout << "render target pool: " << poolMismatches << " mismatched pixels" << std::endl;
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << e.what() << std::endl;
+			return 1;
+		}
+		return boxMismatches + poolMismatches == 0 ? 0 : 1;
+	}
+
+	//SFML --rate [ticks per second] [max steps per frame]: play with another fixed simulation rate
+	unsigned int ticksPerSecond = 60;
+	unsigned int maxStepsPerFrame = 5;
+	if (argc > 1 && std::string(argv[1]) == "--rate")
+	{
+		ticksPerSecond = argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : ticksPerSecond;
+		maxStepsPerFrame = argc > 3 ? static_cast<unsigned int>(std::stoul(argv[3])) : maxStepsPerFrame;
+		if (ticksPerSecond == 0 || maxStepsPerFrame == 0)
+		{
+			std::cerr << "--rate needs a tick rate and step limit above zero" << std::endl;
+			return 1;
+		}
+	}
+
+	Application app(ticksPerSecond, maxStepsPerFrame);
 
 	app.run();
 
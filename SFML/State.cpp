@@ -37,12 +37,20 @@ namespace GEX {
 		TextureManager& textures,
 		PlayerControl& player,
 		MusicPlayer& music,
-		SoundPlayer& sound)
+		SoundPlayer& sound,
+		RenderTargetPool& renderTargets,
+		QualityGovernor& quality,
+		ThreadPool& threads,
+		FixedTimestep& timestep)
 		: window(&window)
 		, textures(&textures)
 		, player(&player)
 		, music(&music)
 		, sound(&sound)
+		, renderTargets(&renderTargets)
+		, quality(&quality)
+		, threads(&threads)
+		, timestep(&timestep)
 	{}
 
 	State::State(StateStack & stack, Context context)
@@ -35,6 +35,10 @@
 #include "StateIdentifiers.h"
 #include "CommandQueue.h"
 #include "MusicPlayer.h"
+#include "RenderTargetPool.h"
+#include "QualityGovernor.h"
+#include "ThreadPool.h"
+#include "FixedTimestep.h"
 
 namespace GEX {
 
@@ -56,7 +60,11 @@ namespace GEX {
 				TextureManager& textures,
 				PlayerControl& player,
 				MusicPlayer& music,
-				SoundPlayer& sound);
+				SoundPlayer& sound,
+				RenderTargetPool& renderTargets,
+				QualityGovernor& quality,
+				ThreadPool& threads,
+				FixedTimestep& timestep);
 
 
 			sf::RenderWindow*   window;
@@ -64,6 +72,10 @@ namespace GEX {
 			PlayerControl*		player;
 			MusicPlayer*		music;
 			SoundPlayer*		sound;
+			RenderTargetPool*	renderTargets;
+			QualityGovernor*	quality;
+			ThreadPool*			threads;
+			FixedTimestep*		timestep;
 		};
 
 	public:
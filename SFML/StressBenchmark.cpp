@@ -0,0 +1,304 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "StressBenchmark.h"
+#include "AllocationCounter.h"
+#include "Utility.h"
+#include <SFML/System/Clock.hpp>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace GEX {
+
+	namespace
+	{
+		const sf::Time		TICK = sf::seconds(1.f / 60.f);
+		const float			AREA_PER_ENTITY = 128.f * 128.f;	//view grows with the count so density stays put
+		const float			MIN_VIEW_SIZE = 1024.f;
+
+		const char* const	PHASE_NAMES[UpdateProfile::PhaseCount] = {
+			"scroll", "commands", "collisions", "wrecks", "scene_update", "spawning"
+		};
+
+		std::size_t scale(std::size_t entities, float share)
+		{
+			return static_cast<std::size_t>(std::round(entities * share));
+		}
+
+		long long nanosecondsPerTick(const UpdateProfile& profile)
+		{
+			long long total = 0;
+			for (long long ns : profile.nanoseconds)
+				total += ns;
+
+			return total / static_cast<long long>(std::max<std::size_t>(profile.ticks, 1));
+		}
+	}
+
+	StressBenchmark::Mix StressBenchmark::Mix::homing()
+	{
+		Mix mix;
+		mix.enemies = 0.3f;
+		mix.bullets = 0.1f;
+		mix.missiles = 0.5f;
+		mix.pickups = 0.05f;
+		mix.particles = 0.05f;
+
+		return mix;
+	}
+
+	StressBenchmark::StressBenchmark(std::size_t ticks, sf::Time budget)
+		: ticks_(ticks)
+		, budget_(budget)
+		, mix_()
+		, threads_(nullptr)
+		, counts_()
+		, points_()
+	{
+	}
+
+	void StressBenchmark::setMix(const Mix & mix)
+	{
+		mix_ = mix;
+	}
+
+	void StressBenchmark::setThreadPool(ThreadPool * threads)
+	{
+		threads_ = threads;
+	}
+
+	void StressBenchmark::addCount(std::size_t entities)
+	{
+		counts_.push_back(entities);
+	}
+
+	void StressBenchmark::addSweep(std::size_t first, std::size_t last)
+	{
+		//10, 30, 100, 300, ...
+		for (std::size_t decade = first; decade <= last; decade *= 10)
+		{
+			addCount(decade);
+			if (decade * 3 <= last)
+				addCount(decade * 3);
+		}
+	}
+
+	void StressBenchmark::run()
+	{
+		TextureManager textures;
+		World::prepareHeadless(textures);
+
+		if (!isCountingAllocations())
+			std::cout << "built without GEX_COUNT_ALLOCATIONS, allocation columns will be 0" << std::endl;
+
+		//the budget is only checked between ticks, so a point whose first tick alone
+		//would overrun it is skipped, predicted from the largest point measured so far
+		const double budgetNs = budget_.asMicroseconds() * 1000.0;
+		std::size_t largest = 0;
+		long long largestNs = 0;
+
+		points_.clear();
+		for (std::size_t entities : counts_)
+		{
+			if (largest && entities > largest)
+			{
+				const double growth = static_cast<double>(entities) / largest;
+				const double predictedNs = largestNs * growth * growth;	//collisions are pairwise
+				if (predictedNs > budgetNs)
+				{
+					std::cout << entities << " entities: skipped, predicted " << static_cast<long long>(predictedNs)
+						<< " ns/tick is over the budget" << std::endl;
+					continue;
+				}
+			}
+
+			points_.push_back(measure(entities, textures));
+
+			const Point& point = points_.back();
+			const long long ns = nanosecondsPerTick(point.profile);
+			if (entities > largest)
+			{
+				largest = entities;
+				largestNs = ns;
+			}
+
+			std::cout << entities << " entities: " << ns << " ns/tick over " << point.profile.ticks << " ticks" << std::endl;
+			if (threads_ && !point.isPooledMatch)
+				std::cout << entities << " entities: pooled hit responses changed the outcome" << std::endl;
+		}
+	}
+
+	bool StressBenchmark::isPooledConsistent() const
+	{
+		return std::all_of(points_.begin(), points_.end(), [](const Point& point) { return point.isPooledMatch; });
+	}
+
+	StressBenchmark::Point StressBenchmark::measure(std::size_t entities, const TextureManager & textures) const
+	{
+		float side = std::max(MIN_VIEW_SIZE, std::sqrt(entities * AREA_PER_ENTITY));
+
+		Point point;
+		point.entities = entities;
+		point.population = World::Population{
+			scale(entities, mix_.enemies),
+			scale(entities, mix_.bullets),
+			scale(entities, mix_.missiles),
+			scale(entities, mix_.pickups),
+			scale(entities, mix_.particles)
+		};
+
+		Outcome serial = simulate(point.population, side, textures, nullptr, ticks_, budget_);
+		point.profile = serial.profile;
+		point.liveAtEnd = serial.liveAtEnd;
+		point.particles = serial.particles;
+		point.pooledProfile = UpdateProfile();
+		point.isPooledMatch = true;
+
+		//exactly as many ticks as the serial run managed, with every tick's hits going through the pool
+		if (threads_)
+		{
+			Outcome pooled = simulate(point.population, side, textures, threads_, serial.profile.ticks, sf::Time::Zero);
+			point.pooledProfile = pooled.profile;
+			point.isPooledMatch = pooled.liveAtEnd == serial.liveAtEnd
+				&& pooled.particles.emitted == serial.particles.emitted
+				&& pooled.statistics.damageTaken == serial.statistics.damageTaken
+				&& pooled.statistics.enemiesDestroyed == serial.statistics.enemiesDestroyed
+				&& pooled.statistics.pickupsCollected == serial.statistics.pickupsCollected
+				&& pooled.statistics.shotsFired == serial.statistics.shotsFired;
+		}
+
+		return point;
+	}
+
+	StressBenchmark::Outcome StressBenchmark::simulate(const World::Population & population, float side,
+		const TextureManager & textures, ThreadPool * threads, std::size_t ticks, sf::Time budget) const
+	{
+		seedRandom(1);	//same scenario every run
+
+		World world(sf::Vector2f(side, side), textures, GameData());
+		world.setThreadPool(threads, 0);
+		world.populate(population);
+
+		//only update is measured, building and tearing down the scene is not
+		Outcome outcome;
+		const ParticleNode::Counters particlesBefore = world.getParticleCounters();
+		world.setProfile(&outcome.profile);
+
+		sf::Clock clock;
+		for (std::size_t tick = 0; tick < ticks; ++tick)
+		{
+			world.update(TICK, world.getCommandQueue());
+
+			if (budget != sf::Time::Zero && clock.getElapsedTime() > budget)
+				break;
+		}
+
+		world.setProfile(nullptr);
+		outcome.liveAtEnd = world.getEntityCount();
+		outcome.statistics = world.getStatistics();
+
+		const ParticleNode::Counters particlesAfter = world.getParticleCounters();
+		outcome.particles.emitted = particlesAfter.emitted - particlesBefore.emitted;
+		outcome.particles.dropped = particlesAfter.dropped - particlesBefore.dropped;
+		outcome.particles.evicted = particlesAfter.evicted - particlesBefore.evicted;
+
+		return outcome;
+	}
+
+	void StressBenchmark::writeResults(const std::string & path) const
+	{
+		std::ofstream out(path);
+
+		out << "entities,enemies,bullets,missiles,pickups,particles,ticks,live_at_end,ns_per_tick";
+		for (const char* name : PHASE_NAMES)
+			out << ',' << name << "_ns_per_tick";
+		out << ",allocations_per_tick";
+		for (const char* name : PHASE_NAMES)
+			out << ',' << name << "_allocations_per_tick";
+		out << ",particles_emitted_per_tick,particles_dropped_per_tick,particles_evicted_per_tick";
+		out << ",bounds_overlaps_per_tick,oriented_tests_per_tick,oriented_rejections_per_tick";
+		if (threads_)
+			out << ",pooled_ns_per_tick,pooled_collisions_ns_per_tick,pooled_matches";
+		out << '\n';
+
+		for (const Point& point : points_)
+		{
+			const UpdateProfile& profile = point.profile;
+			const double ticks = static_cast<double>(profile.ticks);
+
+			double nanoseconds = 0.0;
+			double allocations = 0.0;
+			for (int phase = 0; phase < UpdateProfile::PhaseCount; ++phase)
+			{
+				nanoseconds += profile.nanoseconds[phase];
+				allocations += profile.allocations[phase];
+			}
+
+			out << point.entities << ','
+				<< point.population.enemies << ',' << point.population.bullets << ','
+				<< point.population.missiles << ',' << point.population.pickups << ','
+				<< point.population.particles << ','
+				<< profile.ticks << ',' << point.liveAtEnd << ','
+				<< nanoseconds / ticks;
+			for (long long ns : profile.nanoseconds)
+				out << ',' << ns / ticks;
+			out << ',' << allocations / ticks;
+			for (std::size_t count : profile.allocations)
+				out << ',' << count / ticks;
+			out << ',' << point.particles.emitted / ticks
+				<< ',' << point.particles.dropped / ticks
+				<< ',' << point.particles.evicted / ticks;
+			out << ',' << profile.boundsOverlaps / ticks
+				<< ',' << profile.orientedTests / ticks
+				<< ',' << profile.orientedRejections / ticks;
+			if (threads_)
+			{
+				const UpdateProfile& pooled = point.pooledProfile;
+				const double pooledTicks = static_cast<double>(std::max<std::size_t>(pooled.ticks, 1));
+
+				long long pooledNanoseconds = 0;
+				for (long long ns : pooled.nanoseconds)
+					pooledNanoseconds += ns;
+
+				out << ',' << pooledNanoseconds / pooledTicks
+					<< ',' << pooled.nanoseconds[UpdateProfile::Collisions] / pooledTicks
+					<< ',' << (point.isPooledMatch ? 1 : 0);
+			}
+			out << '\n';
+		}
+
+		if (!out)
+		{
+			throw std::runtime_error("Results write failed " + path);
+		}
+	}
+}
@@ -0,0 +1,99 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "World.h"
+#include <SFML/System/Time.hpp>
+#include <string>
+#include <vector>
+
+namespace GEX {
+
+	//steps synthetic headless scenarios of growing size and reports the cost of each update phase
+	class StressBenchmark
+	{
+	public:
+		//share of each kind of entity, scaled to every count in the sweep
+		struct Mix
+		{
+			float							enemies = 0.2f;
+			float							bullets = 0.5f;
+			float							missiles = 0.05f;
+			float							pickups = 0.05f;
+			float							particles = 0.2f;
+
+			static Mix						homing();	//mostly guided missiles, to load the oriented box test
+		};
+
+		struct Point
+		{
+			std::size_t						entities;
+			World::Population				population;
+			std::size_t						liveAtEnd;	//entities still in the air after the last tick
+			ParticleNode::Counters			particles;	//during the measured ticks only
+			UpdateProfile					profile;
+			UpdateProfile					pooledProfile;	//same ticks with hit responses always on the pool
+			bool							isPooledMatch;	//the pooled run ended in the same state
+		};
+
+	public:
+		explicit							StressBenchmark(std::size_t ticks = 120, sf::Time budget = sf::seconds(10.f));
+
+		void								setMix(const Mix& mix);
+		void								setThreadPool(ThreadPool* threads);	//also rerun every point pooled and compare
+		void								addCount(std::size_t entities);
+		void								addSweep(std::size_t first, std::size_t last);	//1-3-10 steps
+
+		void								run();
+		void								writeResults(const std::string& path) const;
+		bool								isPooledConsistent() const;	//every pooled rerun matched, true without a pool
+
+	private:
+		struct Outcome
+		{
+			UpdateProfile					profile;
+			std::size_t						liveAtEnd;
+			ParticleNode::Counters			particles;
+			World::Statistics				statistics;
+		};
+
+	private:
+		Point								measure(std::size_t entities, const TextureManager& textures) const;
+		Outcome								simulate(const World::Population& population, float side, const TextureManager& textures,
+												ThreadPool* threads, std::size_t ticks, sf::Time budget) const;	//zero budget runs every tick
+
+	private:
+		std::size_t							ticks_;		//per point, fewer if the budget runs out
+		sf::Time							budget_;	//per point, skipped if one tick is predicted to overrun it
+		Mix									mix_;
+		ThreadPool*							threads_;	//null measures the serial path only
+		std::vector<std::size_t>			counts_;
+		std::vector<Point>					points_;
+	};
+}
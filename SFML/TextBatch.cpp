@@ -0,0 +1,87 @@
+/*
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "TextBatch.h"
+#include "FontManager.h"
+#include <SFML/Graphics/RenderTarget.hpp>
+
+namespace GEX {
+
+	TextBatch::TextBatch(FontID font, unsigned int characterSize)
+		: font_(FontManager::getInstance().get(font))
+		, characterSize_(characterSize)
+		, vertices_(sf::Quads)
+		, isVisible_(true)
+	{
+	}
+
+	const sf::Font & TextBatch::getFont() const
+	{
+		return font_;
+	}
+
+	unsigned int TextBatch::getCharacterSize() const
+	{
+		return characterSize_;
+	}
+
+	void TextBatch::append(const std::vector<sf::Vertex>& quads, const sf::Transform & transform)
+	{
+		if (!isVisible_)
+			return;
+
+		for (sf::Vertex vertex : quads)
+		{
+			vertex.position = transform.transformPoint(vertex.position);
+			vertices_.append(vertex);
+		}
+	}
+
+	void TextBatch::clear()
+	{
+		vertices_.clear();
+	}
+
+	void TextBatch::setVisible(bool flag)
+	{
+		isVisible_ = flag;
+
+		if (!isVisible_)
+			clear();
+	}
+
+	void TextBatch::draw(sf::RenderTarget & target, sf::RenderStates states) const
+	{
+		if (vertices_.getVertexCount() == 0)
+			return;
+
+		states.texture = &font_.getTexture(characterSize_);
+		target.draw(vertices_, states);
+	}
+}
@@ -0,0 +1,62 @@
+/*
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <vector>
+#include "ResourceIdentifiers.h"
+
+namespace GEX {
+
+	//collects the glyph quads of every label so they go out in a single draw call
+	class TextBatch : public sf::Drawable
+	{
+	public:
+		explicit				TextBatch(FontID font = FontID::Main, unsigned int characterSize = 20);
+
+		const sf::Font&			getFont() const;
+		unsigned int			getCharacterSize() const;
+
+								//add pre-built glyph quads, transformed to the batch's space
+		void					append(const std::vector<sf::Vertex>& quads, const sf::Transform& transform);
+		void					clear();	//keeps capacity, call once per frame
+		void					setVisible(bool flag);	//hidden batches ignore appends and draws
+
+	private:
+		void					draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+	private:
+		const sf::Font&			font_;
+		unsigned int			characterSize_;
+		sf::VertexArray			vertices_;
+		bool					isVisible_;
+	};
+}
@@ -28,27 +28,101 @@
 */
 
 #include "TextNode.h"
-#include "Utility.h"
-#include <SFML/Graphics/RenderTarget.hpp>
-#include "FontManager.h"
+#include "TextBatch.h"
+#include <SFML/Graphics/Font.hpp>
+#include <algorithm>
+#include <limits>
 
 namespace GEX {
 
-	TextNode::TextNode(const std::string & text)
+	TextNode::TextNode(const std::string & text, TextBatch& batch)
+		: text_(text)
+		, batch_(batch)
+		, glyphs_()
+		, needsGlyphUpdate_(true)
 	{
-		text_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
-		text_.setCharacterSize(20);
-		setText(text);
 	}
 
 	void TextNode::setText(const std::string & text)
 	{
-		text_.setString(text);
-		centerOrigin(text_);
+		if (text == text_)
+			return;
+
+		text_ = text;
+		needsGlyphUpdate_ = true;
+	}
+
+	void TextNode::drawCurrent(sf::RenderTarget &, sf::RenderStates states) const
+	{
+		if (needsGlyphUpdate_)
+		{
+			buildGlyphs();
+			needsGlyphUpdate_ = false;
+		}
+
+		batch_.append(glyphs_, states.transform);
 	}
 
-	void TextNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void TextNode::buildGlyphs() const
 	{
-		target.draw(text_, states);
+		const sf::Font& font = batch_.getFont();
+		const unsigned int characterSize = batch_.getCharacterSize();
+
+		glyphs_.clear();
+
+		//same layout as sf::Text: single line, baseline at characterSize
+		float x = 0.f;
+		float y = static_cast<float>(characterSize);
+		sf::Uint32 previous = 0;
+
+		float minX = std::numeric_limits<float>::max();
+		float minY = std::numeric_limits<float>::max();
+		float maxX = std::numeric_limits<float>::lowest();
+		float maxY = std::numeric_limits<float>::lowest();
+
+		for (char c : text_)
+		{
+			sf::Uint32 current = static_cast<unsigned char>(c);
+			x += font.getKerning(previous, current, characterSize);
+			previous = current;
+
+			const sf::Glyph& glyph = font.getGlyph(current, characterSize, false);
+
+			if (current == ' ')
+			{
+				x += glyph.advance;
+				continue;
+			}
+
+			float left = x + glyph.bounds.left;
+			float top = y + glyph.bounds.top;
+			float right = left + glyph.bounds.width;
+			float bottom = top + glyph.bounds.height;
+
+			float u1 = static_cast<float>(glyph.textureRect.left);
+			float v1 = static_cast<float>(glyph.textureRect.top);
+			float u2 = u1 + glyph.textureRect.width;
+			float v2 = v1 + glyph.textureRect.height;
+
+			glyphs_.push_back(sf::Vertex(sf::Vector2f(left, top), sf::Color::White, sf::Vector2f(u1, v1)));
+			glyphs_.push_back(sf::Vertex(sf::Vector2f(right, top), sf::Color::White, sf::Vector2f(u2, v1)));
+			glyphs_.push_back(sf::Vertex(sf::Vector2f(right, bottom), sf::Color::White, sf::Vector2f(u2, v2)));
+			glyphs_.push_back(sf::Vertex(sf::Vector2f(left, bottom), sf::Color::White, sf::Vector2f(u1, v2)));
+
+			minX = std::min(minX, left);
+			minY = std::min(minY, top);
+			maxX = std::max(maxX, right);
+			maxY = std::max(maxY, bottom);
+
+			x += glyph.advance;
+		}
+
+		if (glyphs_.empty())
+			return;
+
+		//center origin, matching centerOrigin(sf::Text)
+		sf::Vector2f origin((maxX - minX) / 2.f, (maxY - minY) / 2.f);
+		for (sf::Vertex& vertex : glyphs_)
+			vertex.position -= origin;
 	}
 }
\ No newline at end of file
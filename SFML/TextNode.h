@@ -29,22 +29,30 @@
 
 #pragma once
 #include "SceneNode.h"
-#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <string>
+#include <vector>
 
 namespace GEX {
 
+	class TextBatch;
+
 	class TextNode : public SceneNode
 	{
 	public:
-		explicit				TextNode(const std::string& text);
+								TextNode(const std::string& text, TextBatch& batch);
 		
-		void					setText(const std::string& text);
+		void					setText(const std::string& text);	//glyph quads are rebuilt on the next draw, only if text changed
 
 	private:
 		virtual	void		    drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void					buildGlyphs() const;
 
 	private:
-		sf::Text				text_;
+		std::string				text_;
+		TextBatch&				batch_;
+		mutable std::vector<sf::Vertex>	glyphs_;	//quads in local space, origin centered
+		mutable bool			needsGlyphUpdate_;	//font pages are only touched when drawing, never by headless Worlds
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,195 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cassert>
+
+namespace GEX {
+
+	sf::IntRect TextureRegion::map(const sf::IntRect & local) const
+	{
+		return sf::IntRect(rect.left + local.left, rect.top + local.top, local.width, local.height);
+	}
+
+	TextureAtlas::TextureAtlas(unsigned int pageSize, unsigned int padding)
+		: pageSize_(std::min(pageSize, sf::Texture::getMaximumSize()))
+		, padding_(padding)
+		, pending_()
+		, pages_()
+		, regions_()
+	{
+	}
+
+	void TextureAtlas::add(TextureID id, const std::string & path)
+	{
+		Entry entry;
+		entry.id = id;
+		entry.page = 0;
+
+		if (!entry.image.loadFromFile(path))
+		{
+			throw std::runtime_error("Texture load failed " + path);
+		}
+
+		sf::Vector2u size = entry.image.getSize();
+		if (size.x + 2 * padding_ > pageSize_ || size.y + 2 * padding_ > pageSize_)
+		{
+			throw std::runtime_error("Texture too large for atlas " + path);
+		}
+
+		pending_.push_back(std::move(entry));
+	}
+
+	void TextureAtlas::pack()
+	{
+		if (pending_.empty())
+			return;
+
+		//tallest first keeps shelves tight
+		std::sort(pending_.begin(), pending_.end(), [](const Entry& a, const Entry& b)
+		{
+			return a.image.getSize().y > b.image.getSize().y;
+		});
+
+		//shelf packing: fill a row left to right, open a new row below, open a new page when full
+		std::vector<sf::Vector2u> pageSizes(1, sf::Vector2u(0, 0));
+		unsigned int x = 0;
+		unsigned int y = 0;
+		unsigned int shelfHeight = 0;
+
+		for (Entry& entry : pending_)
+		{
+			sf::Vector2u size = entry.image.getSize() + sf::Vector2u(2 * padding_, 2 * padding_);
+
+			if (x + size.x > pageSize_)
+			{
+				x = 0;
+				y += shelfHeight;
+				shelfHeight = 0;
+			}
+
+			if (y + size.y > pageSize_)
+			{
+				pageSizes.push_back(sf::Vector2u(0, 0));
+				x = 0;
+				y = 0;
+				shelfHeight = 0;
+			}
+
+			entry.page = pages_.size() + pageSizes.size() - 1;
+			entry.position = sf::Vector2u(x + padding_, y + padding_);
+
+			x += size.x;
+			shelfHeight = std::max(shelfHeight, size.y);
+
+			//pages are only as large as their content
+			pageSizes.back().x = std::max(pageSizes.back().x, x);
+			pageSizes.back().y = std::max(pageSizes.back().y, y + size.y);
+		}
+
+		for (sf::Vector2u pageSize : pageSizes)
+		{
+			sf::Image image;
+			image.create(pageSize.x, pageSize.y, sf::Color::Transparent);
+
+			for (const Entry& entry : pending_)
+			{
+				if (entry.page == pages_.size())
+					blit(image, entry);
+			}
+
+			std::unique_ptr<sf::Texture> page(new sf::Texture());
+			if (!page->loadFromImage(image))
+			{
+				throw std::runtime_error("Atlas page upload failed");
+			}
+			pages_.push_back(std::move(page));
+		}
+
+		for (const Entry& entry : pending_)
+		{
+			sf::Vector2u size = entry.image.getSize();
+
+			TextureRegion region;
+			region.texture = pages_[entry.page].get();
+			region.rect = sf::IntRect(entry.position.x, entry.position.y, size.x, size.y);
+
+			auto rc = regions_.insert(std::make_pair(entry.id, region));
+			assert(rc.second);
+		}
+
+		pending_.clear();
+	}
+
+	bool TextureAtlas::contains(TextureID id) const
+	{
+		return regions_.find(id) != regions_.end();
+	}
+
+	const TextureRegion & TextureAtlas::get(TextureID id) const
+	{
+		auto found = regions_.find(id);
+
+		if (found == regions_.end())
+		{
+			throw std::runtime_error("Didn't find texture in atlas");
+		}
+
+		return found->second;
+	}
+
+	std::size_t TextureAtlas::getPageCount() const
+	{
+		return pages_.size();
+	}
+
+	void TextureAtlas::blit(sf::Image & page, const Entry & entry) const
+	{
+		sf::Vector2u size = entry.image.getSize();
+		page.copy(entry.image, entry.position.x, entry.position.y);
+
+		//repeat the outermost pixels into the padding
+		int pad = static_cast<int>(padding_);
+		for (int dy = -pad; dy < static_cast<int>(size.y) + pad; ++dy)
+		{
+			for (int dx = -pad; dx < static_cast<int>(size.x) + pad; ++dx)
+			{
+				if (dx >= 0 && dy >= 0 && dx < static_cast<int>(size.x) && dy < static_cast<int>(size.y))
+					continue;
+
+				unsigned int sx = static_cast<unsigned int>(std::min(std::max(dx, 0), static_cast<int>(size.x) - 1));
+				unsigned int sy = static_cast<unsigned int>(std::min(std::max(dy, 0), static_cast<int>(size.y) - 1));
+
+				page.setPixel(entry.position.x + dx, entry.position.y + dy, entry.image.getPixel(sx, sy));
+			}
+		}
+	}
+}
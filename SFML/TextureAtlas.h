@@ -0,0 +1,85 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include "ResourceIdentifiers.h"
+
+namespace GEX {
+
+	//where an image ended up: the page texture and its area on that page
+	struct TextureRegion
+	{
+		sf::IntRect								map(const sf::IntRect& local) const;	//image coords to page coords
+
+		sf::Texture*							texture;
+		sf::IntRect								rect;
+	};
+
+	//packs many small images into a few large textures so sprites share texture binds
+	class TextureAtlas
+	{
+	public:
+		explicit								TextureAtlas(unsigned int pageSize = 2048, unsigned int padding = 2);
+												TextureAtlas(const TextureAtlas&) = delete;
+		TextureAtlas&							operator=(const TextureAtlas&) = delete;
+
+		void									add(TextureID id, const std::string& path);	//queue an image for packing
+		void									pack();		//place queued images on new pages and upload them
+
+		bool									contains(TextureID id) const;
+		const TextureRegion&					get(TextureID id) const;
+		std::size_t								getPageCount() const;
+
+	private:
+		struct Entry
+		{
+			TextureID							id;
+			sf::Image							image;
+			sf::Vector2u						position;
+			std::size_t							page;
+		};
+
+	private:
+		void									blit(sf::Image& page, const Entry& entry) const;
+
+	private:
+		unsigned int							pageSize_;
+		unsigned int							padding_;		//edge pixels are repeated into it to stop filtering bleed
+		std::vector<Entry>						pending_;
+		std::vector<std::unique_ptr<sf::Texture>>	pages_;
+		std::map<TextureID, TextureRegion>		regions_;
+	};
+}
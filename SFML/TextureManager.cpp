@@ -56,8 +56,23 @@ namespace GEX {
 
 	}
 
-	sf::Texture& TextureManager::get(TextureID id) const
+	void TextureManager::loadToAtlas(TextureID id, const std::string & path)
 	{
+		atlas_.add(id, path);
+	}
+
+	void TextureManager::packAtlas()
+	{
+		atlas_.pack();
+	}
+
+	TextureRegion TextureManager::get(TextureID id) const
+	{
+		if (atlas_.contains(id))
+		{
+			return atlas_.get(id);
+		}
+
 		auto found = textures_.find(id);
 
 		//assert(found != textures_.end());
@@ -66,6 +81,8 @@ namespace GEX {
 			throw std::exception("Didn't find texture");
 		}
 
-		return *(found->second); //dereferences pointer to give object its pointing to
+		//standalone texture, region is the whole texture
+		sf::Texture& texture = *(found->second); //dereferences pointer to give object its pointing to
+		return TextureRegion{ &texture, sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y) };
 	}
 }
@@ -32,6 +32,7 @@
 #include <memory>
 #include <SFML/Graphics.hpp>
 #include "ResourceIdentifiers.h"
+#include "TextureAtlas.h"
 namespace GEX {
 
 
@@ -40,13 +41,18 @@ namespace GEX {
 	public:
 		TextureManager();
 		~TextureManager();
-																//load texture from path
+																//load texture from path into its own texture (needed for repeated textures)
 		void													load(TextureID id, const std::string& path);
-																//return textureID
-		sf::Texture&											get(TextureID id) const;
+																//queue texture from path for the atlas
+		void													loadToAtlas(TextureID id, const std::string& path);
+																//pack queued textures into atlas pages
+		void													packAtlas();
+																//return page texture and area of textureID
+		TextureRegion											get(TextureID id) const;
 
 	private:
 		std::map<TextureID, std::unique_ptr<sf::Texture>>		textures_;   //holds texture objects in smart pointers
+		TextureAtlas											atlas_;
 	};
 }
 
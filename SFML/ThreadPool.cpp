@@ -0,0 +1,138 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <exception>
+#include <future>
+
+namespace GEX {
+
+	ThreadPool::ThreadPool(std::size_t workerCount)
+		: workers_()
+		, jobs_()
+		, mutex_()
+		, wake_()
+		, isStopping_(false)
+	{
+		//hardware_concurrency may report 0, the caller counts as one thread
+		std::size_t count = workerCount > 1 ? workerCount - 1 : 0;
+
+		for (std::size_t i = 0; i < count; ++i)
+			workers_.emplace_back(&ThreadPool::workerLoop, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			isStopping_ = true;
+		}
+		wake_.notify_all();
+
+		for (std::thread& worker : workers_)
+			worker.join();
+	}
+
+	std::size_t ThreadPool::getWorkerCount() const
+	{
+		return workers_.size() + 1;
+	}
+
+	void ThreadPool::parallelFor(std::size_t count, const RangeJob & job)
+	{
+		if (count == 0)
+			return;
+
+		std::size_t chunks = std::min(count, getWorkerCount());
+		std::size_t chunkSize = (count + chunks - 1) / chunks;
+
+		std::vector<std::future<void>> pending;
+		pending.reserve(chunks);
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			for (std::size_t begin = chunkSize; begin < count; begin += chunkSize)
+			{
+				std::size_t end = std::min(begin + chunkSize, count);
+				auto task = std::make_shared<std::packaged_task<void()>>([&job, begin, end]() { job(begin, end); });
+
+				pending.push_back(task->get_future());
+				jobs_.push_back([task]() { (*task)(); });
+			}
+		}
+		wake_.notify_all();
+
+		//every chunk must finish before job goes out of scope, even if one throws
+		std::exception_ptr error;
+		try
+		{
+			job(0, std::min(chunkSize, count));
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+
+		for (std::future<void>& done : pending)
+		{
+			try
+			{
+				done.get();
+			}
+			catch (...)
+			{
+				if (!error)
+					error = std::current_exception();
+			}
+		}
+
+		if (error)
+			std::rethrow_exception(error);
+	}
+
+	void ThreadPool::workerLoop()
+	{
+		for (;;)
+		{
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				wake_.wait(lock, [this]() { return isStopping_ || !jobs_.empty(); });
+
+				if (isStopping_ && jobs_.empty())
+					return;
+
+				job = std::move(jobs_.front());
+				jobs_.pop_front();
+			}
+			job();
+		}
+	}
+}
@@ -0,0 +1,68 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GEX {
+
+	//fixed set of worker threads for splitting per-frame work across cores
+	class ThreadPool
+	{
+	public:
+		typedef std::function<void(std::size_t begin, std::size_t end)> RangeJob;
+
+	public:
+		explicit							ThreadPool(std::size_t workerCount = std::thread::hardware_concurrency());
+											~ThreadPool();
+											ThreadPool(const ThreadPool&) = delete;
+		ThreadPool&							operator=(const ThreadPool&) = delete;
+
+		std::size_t							getWorkerCount() const;
+
+											//split [0, count) into chunks and block until all have run,
+											//the calling thread takes the first chunk itself
+		void								parallelFor(std::size_t count, const RangeJob& job);
+
+	private:
+		void								workerLoop();
+
+	private:
+		std::vector<std::thread>			workers_;
+		std::deque<std::function<void()>>	jobs_;
+		std::mutex							mutex_;
+		std::condition_variable				wake_;
+		bool								isStopping_;
+	};
+}
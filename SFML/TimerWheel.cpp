@@ -0,0 +1,230 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cassert>
+
+namespace GEX {
+
+	namespace
+	{
+		//ids are generation << 32 | index, generations start at 1 so 0 is never an id
+		TimerWheel::Id makeId(std::uint32_t index, std::uint32_t generation)
+		{
+			return (static_cast<TimerWheel::Id>(generation) << 32) | index;
+		}
+
+		std::uint32_t indexOf(TimerWheel::Id id)
+		{
+			return static_cast<std::uint32_t>(id & 0xffffffffu);
+		}
+
+		std::uint32_t generationOf(TimerWheel::Id id)
+		{
+			return static_cast<std::uint32_t>(id >> 32);
+		}
+	}
+
+	const TimerWheel::Id TimerWheel::NoTimer;
+
+	TimerWheel::TimerWheel(sf::Time resolution)
+		: resolution_(resolution)
+		, accumulator_(sf::Time::Zero)
+		, now_(0)
+		, timers_()
+		, freeTimers_()
+		, wheels_()
+		, firing_()
+		, pendingCount_(0)
+	{
+		assert(resolution > sf::Time::Zero);
+	}
+
+	TimerWheel::Id TimerWheel::schedule(sf::Time delay, Callback callback)
+	{
+		std::uint32_t index;
+		if (!freeTimers_.empty())
+		{
+			index = freeTimers_.back();
+			freeTimers_.pop_back();
+		}
+		else
+		{
+			index = static_cast<std::uint32_t>(timers_.size());
+			timers_.push_back(Timer{ Callback(), 0, 1, false });
+		}
+
+		//whole microseconds, float ratios would push exact multiples a tick late
+		sf::Int64 resolution = resolution_.asMicroseconds();
+		sf::Int64 rounded = (std::max<sf::Int64>(delay.asMicroseconds(), 0) + resolution / 2) / resolution;
+		auto ticks = static_cast<std::uint64_t>(rounded);
+
+		Timer& timer = timers_[index];
+		timer.callback = std::move(callback);
+		timer.expiry = now_ + std::max<std::uint64_t>(ticks, 1);	//never on the tick it was scheduled in
+		timer.isPending = true;
+		++pendingCount_;
+
+		Id id = makeId(index, timer.generation);
+		insert(id);
+		return id;
+	}
+
+	void TimerWheel::cancel(Id id)
+	{
+		if (find(id))
+		{
+			release(indexOf(id));
+		}
+	}
+
+	bool TimerWheel::isPending(Id id) const
+	{
+		return find(id) != nullptr;
+	}
+
+	sf::Time TimerWheel::getRemaining(Id id) const
+	{
+		const Timer* timer = find(id);
+		if (!timer)
+			return sf::Time::Zero;
+
+		return resolution_ * static_cast<float>(timer->expiry - now_) - accumulator_;
+	}
+
+	void TimerWheel::advance(sf::Time dt)
+	{
+		accumulator_ += dt;
+		while (accumulator_ >= resolution_)
+		{
+			accumulator_ -= resolution_;
+			tick();
+		}
+	}
+
+	std::size_t TimerWheel::getPendingCount() const
+	{
+		return pendingCount_;
+	}
+
+	void TimerWheel::insert(Id id)
+	{
+		const Timer& timer = timers_[indexOf(id)];
+		std::uint64_t delta = timer.expiry > now_ ? timer.expiry - now_ : 0;
+
+		//the level is picked by distance, the slot by the expiry's own digits
+		int level = 0;
+		while (level < LEVELS - 1 && delta >= (std::uint64_t(1) << (SLOT_BITS * (level + 1))))
+			++level;
+
+		std::uint64_t expiry = std::min(timer.expiry, now_ + (std::uint64_t(1) << (SLOT_BITS * LEVELS)) - 1);
+		std::size_t slot = (expiry >> (SLOT_BITS * level)) & (SLOTS - 1);
+
+		wheels_[level][slot].push_back(id);
+	}
+
+	void TimerWheel::cascade(int level)
+	{
+		std::size_t slot = (now_ >> (SLOT_BITS * level)) & (SLOTS - 1);
+
+		Slot moving;
+		moving.swap(wheels_[level][slot]);
+
+		for (Id id : moving)
+		{
+			if (find(id))
+				insert(id);
+		}
+	}
+
+	void TimerWheel::tick()
+	{
+		++now_;
+
+		//higher levels first, so what they drop into a lower level is moved down again this tick
+		for (int level = LEVELS - 1; level > 0; --level)
+		{
+			if ((now_ & ((std::uint64_t(1) << (SLOT_BITS * level)) - 1)) == 0)
+				cascade(level);
+		}
+
+		//callbacks may schedule more timers, those always land in later slots
+		firing_.swap(wheels_[0][now_ & (SLOTS - 1)]);
+
+		for (Id id : firing_)
+		{
+			Timer* timer = find(id);
+			if (!timer)
+				continue;
+
+			//clamped past the top level, not due yet
+			if (timer->expiry > now_)
+			{
+				insert(id);
+				continue;
+			}
+
+			Callback callback = std::move(timer->callback);
+			release(indexOf(id));
+			callback();
+		}
+
+		firing_.clear();
+	}
+
+	const TimerWheel::Timer * TimerWheel::find(Id id) const
+	{
+		std::uint32_t index = indexOf(id);
+		if (index >= timers_.size())
+			return nullptr;
+
+		const Timer& timer = timers_[index];
+		if (!timer.isPending || timer.generation != generationOf(id))
+			return nullptr;
+
+		return &timer;
+	}
+
+	TimerWheel::Timer * TimerWheel::find(Id id)
+	{
+		return const_cast<Timer*>(static_cast<const TimerWheel&>(*this).find(id));
+	}
+
+	void TimerWheel::release(std::uint32_t index)
+	{
+		Timer& timer = timers_[index];
+		timer.callback = Callback();
+		timer.isPending = false;
+		++timer.generation;
+		--pendingCount_;
+
+		freeTimers_.push_back(index);
+	}
+}
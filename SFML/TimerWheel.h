@@ -0,0 +1,94 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include <SFML/System/Time.hpp>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace GEX {
+
+	//hierarchical timer wheel on the simulation tick, firing costs depend on timers due, not timers pending
+	class TimerWheel
+	{
+	public:
+		using Id = std::uint64_t;
+		using Callback = std::function<void()>;
+
+		static const Id					NoTimer = 0;
+
+	public:
+		explicit						TimerWheel(sf::Time resolution = sf::seconds(1.f / 60.f));
+										TimerWheel(const TimerWheel&) = delete;
+		TimerWheel&						operator=(const TimerWheel&) = delete;
+
+		Id								schedule(sf::Time delay, Callback callback);	//rounded to the nearest tick, at least one
+		void							cancel(Id id);		//stale and NoTimer ids are ignored
+		bool							isPending(Id id) const;
+		sf::Time						getRemaining(Id id) const;	//zero once fired or cancelled
+
+		void							advance(sf::Time dt);	//fires everything due, in schedule order within a tick
+		std::size_t						getPendingCount() const;
+
+	private:
+		static const int				SLOT_BITS = 6;
+		static const int				SLOTS = 1 << SLOT_BITS;
+		static const int				LEVELS = 4;		//64^4 ticks, over three days at 60Hz
+
+		struct Timer
+		{
+			Callback					callback;
+			std::uint64_t				expiry;		//tick it fires on
+			std::uint32_t				generation;	//bumped on fire and cancel so old ids go stale
+			bool						isPending;
+		};
+
+		using Slot = std::vector<Id>;	//stale ids are skipped, so cancel never searches a slot
+
+	private:
+		void							insert(Id id);
+		void							cascade(int level);
+		void							tick();
+		const Timer*					find(Id id) const;
+		Timer*							find(Id id);
+		void							release(std::uint32_t index);
+
+	private:
+		sf::Time						resolution_;
+		sf::Time						accumulator_;
+		std::uint64_t					now_;
+		std::vector<Timer>				timers_;
+		std::vector<std::uint32_t>		freeTimers_;
+		std::array<std::array<Slot, SLOTS>, LEVELS>	wheels_;
+		Slot							firing_;		//reused for the slot being fired
+		std::size_t						pendingCount_;
+	};
+}
@@ -38,7 +38,9 @@ TitleState::TitleState(GEX::StateStack & stack, State::Context context)
 	, showText_(true)
 	, textEffectTime_(sf::Time::Zero)
 {
-	backgroundSpite_.setTexture(context.textures->get(GEX::TextureID::TitleScreen));
+	GEX::TextureRegion texture = context.textures->get(GEX::TextureID::TitleScreen);
+	backgroundSpite_.setTexture(*texture.texture);
+	backgroundSpite_.setTextureRect(texture.rect);
 
 	text_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
 	text_.setString("Press any key to start");
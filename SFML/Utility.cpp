@@ -46,7 +46,7 @@ namespace
 		auto seed = static_cast<unsigned long int>(std::time(nullptr));
 		return std::default_random_engine(seed);
 	}
-	auto RandomEngine = createRandomEngine();
+	thread_local auto RandomEngine = createRandomEngine();	//one per thread so parallel Worlds never share it
 }
 
 
@@ -84,6 +84,21 @@ int randomInt(int exclusiveMax)
 	return distr(RandomEngine);
 }
 
+void seedRandom(unsigned int seed)
+{
+	RandomEngine.seed(seed);
+}
+
+std::default_random_engine getRandomState()
+{
+	return RandomEngine;
+}
+
+void setRandomState(const std::default_random_engine & state)
+{
+	RandomEngine = state;
+}
+
 float length(sf::Vector2f vector)
 {
 	return std::sqrt(vector.x * vector.x + vector.y * vector.y);
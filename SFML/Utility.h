@@ -30,6 +30,7 @@
 #pragma once
 #include <SFML/System/Vector2.hpp>
 #include "Animation.h"
+#include <random>
 
 namespace sf
 {
@@ -49,6 +50,9 @@ float									toRadian(float degree);
 
 //random number generation
 int										randomInt(int exclusiveMax);
+void									seedRandom(unsigned int seed);	//this thread's engine, for repeatable runs
+std::default_random_engine				getRandomState();	//copy of the engine, to rewind the simulation
+void									setRandomState(const std::default_random_engine& state);
 
 
 //vector operations
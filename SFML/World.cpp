@@ -34,40 +34,119 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 #include "PostEffect.h"
 #include "BloomEffect.h"
-#include "SoundNode.h"
+#include "DataTables.h"
+#include "FontManager.h"
+#include "AllocationCounter.h"
+#include "Utility.h"
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+#include <tuple>
 
 namespace GEX {
 
+	namespace
+	{
+		const std::map<QualityTier, QualityData> QUALITY = initializeQualityData();
+		const std::map<Particle::Type, ParticleData> PARTICLES = initializeParticleData();
+		const std::string LEVEL_PATH = "Media/Levels/Level1";
+		const int DESTROYED_SMOKE_PARTICLES = 8;
+	}
+
+	World::World(sf::RenderTarget & outputTarget, SoundPlayer& sounds, RenderTargetPool& renderTargets, ThreadPool& threads)
+		: World(sf::Vector2f(outputTarget.getSize()), nullptr, GameData(), &outputTarget, &sounds, &renderTargets, &threads)
+	{
+		if (PostEffect::isSupported())
+			bloomEffect_.reset(new BloomEffect(renderTargets));
+		else
+			cpuBloomEffect_.reset(new CpuBloomEffect(renderTargets, threads));
+
+		applyQuality();
+	}
+
+	World::World(sf::Vector2f viewSize, const TextureManager & textures, const GameData & data)
+		: World(viewSize, &textures, data, nullptr, nullptr, nullptr, nullptr)
+	{
+	}
 
-	World::World(sf::RenderTarget & outputTarget, SoundPlayer& sounds)
-		: target_(outputTarget)
-		, worldView_(target_.getDefaultView())
-		, textures_()
+	World::World(sf::Vector2f viewSize, const TextureManager * textures, const GameData & data,
+		sf::RenderTarget * target, SoundPlayer * sounds, RenderTargetPool * renderTargets, ThreadPool * threads)
+		: target_(target)
+		, renderTargets_(renderTargets)
+		, threads_(threads)
+		, minParallelResponders_(DEFAULT_PARALLEL_RESPONDERS)
+		, worldView_(sf::FloatRect(0.f, 0.f, viewSize.x, viewSize.y))
+		, previousViewCenter_()
+		, ownTextures_()
+		, textures_(textures ? *textures : ownTextures_)
+		, data_(data)
+		, explosions_()
+		, labels_()
+		, behaviours_()
+		, timers_()
+		, particleSystems_()
+		, events_()
 		, sceneGraph_()
 		, sceneLayers_()
 		, worldBounds_(0.f, 0.f, worldView_.getSize().x, 2000.f)
 		, spawnPosition_(worldView_.getSize().x / 2.f,
 			worldBounds_.height - worldView_.getSize().y / 2.f)
 		, scrollSpeed_(-50.f)
-		, playerAircraft_(nullptr)
+		, activityMargin_(0.f)
+		, inactiveTickInterval_(4)
+		, playerAircraft_()
+		, background_()
+		, activeEnemies_()
+		, colliders_()
+		, contacts_()
+		, responses_()
+		, responders_()
+		, collisionMatrix_(CollisionMatrix::gameplay())
 		, bloomEffect_()
+		, cpuBloomEffect_()
+		, finishLine_()
 		, sounds_(sounds)
+		, qualityTier_(QualityTier::High)
+		, statistics_()
+		, profile_(nullptr)
+		, phaseStart_()
+		, phaseAllocations_(0)
 	{
-		sceneTexture_.create(target_.getSize().x, target_.getSize().y);
-		loadTextures();
+		loadLevel();
+
+		if (!textures)
+			loadTextures(ownTextures_);
 		buildScene();
+		subscribeToEvents();
 
 		//set view
 		worldView_.setCenter(spawnPosition_);
+		previousViewCenter_ = spawnPosition_;
+		streamBackground();
 	}
 
 	void World::update(sf::Time dt, CommandQueue& commands)
 	{
+		if (profile_)
+		{
+			++profile_->ticks;
+			phaseStart_ = std::chrono::steady_clock::now();
+			phaseAllocations_ = getAllocationCount();
+		}
+
+		//start of tick, draw blends from here
+		previousViewCenter_ = worldView_.getCenter();
+		sceneGraph_.saveTransform();
+
 		//scroll the world
 		worldView_.move(0.f, scrollSpeed_ * dt.asSeconds());
-		playerAircraft_->setVelocity(0.f, 0.f);
+		streamBackground();
+		if (Aircraft* player = getPlayer())
+			player->setVelocity(0.f, 0.f);
+		markPhase(UpdateProfile::Scroll);
 
 		destroyOutOfViewEntities();
+		scheduleActivity();
 		guideMissiles();
 
 		//run all commands in command queue
@@ -75,57 +154,99 @@ namespace GEX {
 		{
 			sceneGraph_.onCommand(commandQueue_.pop(), dt);
 		}
+		markPhase(UpdateProfile::Commands);
+
 		handleCollisions();
+		markPhase(UpdateProfile::Collisions);
+
 		sceneGraph_.removeWrecks();
+		markPhase(UpdateProfile::Wrecks);
 
 		adaptPlayerVelocity();
+		behaviours_.update(dt);
+		timers_.advance(dt);
 		sceneGraph_.update(dt, commands);
 		adaptPlayerPosition();
+		updateBoundingBoxes();
+		markPhase(UpdateProfile::SceneUpdate);
+
 		spawnEnemies();
+		events_.dispatch();
 		updateSounds();
 
+		if (hasAlivePlayer())
+			statistics_.timeAlive += dt;
+		markPhase(UpdateProfile::Spawning);
+
 	}
 
 	void World::adaptPlayerVelocity()
 	{
-		sf::Vector2f velocity = playerAircraft_->getVelocity();
+		Aircraft* player = getPlayer();
+		if (!player)
+			return;
+
+		sf::Vector2f velocity = player->getVelocity();
 		if (velocity.x != 0.f && velocity.y != 0.f)
 		{
-			playerAircraft_->setVelocity(velocity / std::sqrt(2.f));
+			player->setVelocity(velocity / std::sqrt(2.f));
 		}
 
 	}
 
 	void World::adaptPlayerPosition() 
 	{
+		Aircraft* player = getPlayer();
+		if (!player)
+			return;
+
 		const float BORDER_DISTANCE = 40.f;
 		sf::FloatRect viewBounds(worldView_.getCenter() - worldView_.getSize() / 2.f, worldView_.getSize());
 
-		sf::Vector2f position = playerAircraft_->getPosition();
+		sf::Vector2f position = player->getPosition();
 		position.x = std::max(position.x, viewBounds.left + BORDER_DISTANCE);
 		position.x = std::min(position.x, viewBounds.left + viewBounds.width - BORDER_DISTANCE);
 
 		position.y = std::max(position.y, viewBounds.top + BORDER_DISTANCE);
 		position.y = std::min(position.y, viewBounds.top + viewBounds.height - BORDER_DISTANCE);
 
-		playerAircraft_->setPosition(position);
+		player->setPosition(position);
 	}
 
-	void World::draw()
+	void World::draw(float alpha)
 	{
-		if (PostEffect::isSupported())
+		assert(target_ != nullptr);
+
+		sceneGraph_.interpolate(alpha);
+
+		sf::View view(worldView_);
+		view.setCenter(previousViewCenter_ + (worldView_.getCenter() - previousViewCenter_) * alpha);
+
+		PostEffect* bloom = bloomEffect_.get();
+		if (!bloom && QUALITY.at(qualityTier_).cpuBloomFallback)
+			bloom = cpuBloomEffect_.get();
+
+		if (bloom)
 		{
-			sceneTexture_.clear();
-			sceneTexture_.setView(worldView_);
-			sceneTexture_.draw(sceneGraph_);
-			sceneTexture_.display();
-			bloomEffect_.apply(sceneTexture_, target_);
+			sf::RenderTexture& sceneTexture = renderTargets_->acquire(target_->getSize());
+
+			sceneTexture.clear();
+			sceneTexture.setView(view);
+			sceneTexture.draw(sceneGraph_);
+			sceneTexture.draw(labels_);
+			sceneTexture.display();
+			bloom->apply(sceneTexture, *target_);
+
+			renderTargets_->release(sceneTexture);
 		}
 		else
 		{
-			target_.setView(worldView_);
-			target_.draw(sceneGraph_);
+			target_->setView(view);
+			target_->draw(sceneGraph_);
+			target_->draw(labels_);
 		}
+
+		labels_.clear();
 	}
 
 	CommandQueue& World::getCommandQueue()
@@ -135,12 +256,14 @@ namespace GEX {
 
 	bool World::hasAlivePlayer() const
 	{
-		return !playerAircraft_->isDestroyed();
+		Aircraft* player = getPlayer();
+		return player && !player->isDestroyed();
 	}
 
 	bool World::hasPlayerReachedEnd() const
 	{
-		return !worldBounds_.contains(playerAircraft_->getPosition());
+		Aircraft* player = getPlayer();
+		return player && !worldBounds_.contains(player->getPosition());
 	}
 
 	void World::destroyOutOfViewEntities()
@@ -156,28 +279,311 @@ namespace GEX {
 		commandQueue_.push(command);
 	}
 
+	void World::setActivityBand(float margin, unsigned int inactiveTickInterval)
+	{
+		activityMargin_ = margin;
+		inactiveTickInterval_ = inactiveTickInterval;
+	}
+
+	void World::scheduleActivity()
+	{
+		//the player is never scheduled, it is always in view
+		Command command;
+		command.category = Category::Type::EnemyAircraft;
+		command.action = derivedAction<Aircraft>([this](Aircraft& enemy, sf::Time)
+		{
+			//wrecks stay awake so their explosion finishes and they get removed
+			bool active = enemy.isDestroyed() || getActivityBounds().intersects(enemy.getBoundingBox());
+			enemy.setTickInterval(active ? 1 : inactiveTickInterval_);
+		});
+
+		commandQueue_.push(command);
+	}
+
 	void World::updateSounds()
 	{
-		sounds_.setListenerPosition(playerAircraft_->getWorldPosition());
-		sounds_.removeStoppedSounds();
+		if (!sounds_)
+			return;
+
+		if (Aircraft* player = getPlayer())
+			sounds_->setListenerPosition(player->getWorldPosition());
+		sounds_->removeStoppedSounds();
+	}
+
+	const World::Statistics & World::getStatistics() const
+	{
+		return statistics_;
+	}
+
+	void World::setQualityTier(QualityTier tier)
+	{
+		if (tier == qualityTier_)
+			return;
+
+		qualityTier_ = tier;
+		applyQuality();
+	}
+
+	void World::saveSnapshot(WorldSnapshot & snapshot) const
+	{
+		assert(hasAlivePlayer());
+
+		snapshot.aircraft.clear();
+		snapshot.projectiles.clear();
+		snapshot.pickups.clear();
+
+		snapshot.aircraft.emplace_back();
+		getPlayer()->save(snapshot.aircraft.front());
+
+		//wrecks are only finishing their explosion, leave them out
+		getLayer(UpperAir).forEachChild([&](const SceneNode& node)
+		{
+			if (node.isDestroyed() || node.getHandle() == playerAircraft_)
+				return;
+
+			if (auto aircraft = dynamic_cast<const Aircraft*>(&node))
+			{
+				snapshot.aircraft.emplace_back();
+				aircraft->save(snapshot.aircraft.back());
+			}
+			else if (auto projectile = dynamic_cast<const Projectile*>(&node))
+			{
+				snapshot.projectiles.emplace_back();
+				projectile->save(snapshot.projectiles.back());
+			}
+			else if (auto pickup = dynamic_cast<const Pickup*>(&node))
+			{
+				snapshot.pickups.emplace_back();
+				pickup->save(snapshot.pickups.back());
+			}
+		});
+
+		snapshot.viewCenter = worldView_.getCenter();
+		snapshot.spawnCursor = level_.tell();
+		snapshot.random = getRandomState();
+		snapshot.statistics = statistics_;
+	}
+
+	void World::restoreSnapshot(const WorldSnapshot & snapshot)
+	{
+		assert(!snapshot.aircraft.empty());
+
+		getLayer(UpperAir).detachChildrenIf([](const SceneNode& node)
+		{
+			return dynamic_cast<const Entity*>(&node) != nullptr;
+		});
+		activeEnemies_.clear();
+
+		while (!commandQueue_.isEmpty())
+			commandQueue_.pop();
+
+		for (const Aircraft::Snapshot& state : snapshot.aircraft)
+		{
+			std::unique_ptr<Aircraft> aircraft(new Aircraft(state.type, textures_, data_, explosions_, labels_, timers_, particleSystems_, events_));
+			aircraft->restore(state);
+			aircraft->attachBehaviour(behaviours_, state.behaviourWait);
+
+			if (&state == &snapshot.aircraft.front())
+				playerAircraft_ = aircraft->getHandle();
+
+			getLayer(UpperAir).attachChild(std::move(aircraft));
+		}
+
+		for (const Projectile::Snapshot& state : snapshot.projectiles)
+		{
+			std::unique_ptr<Projectile> projectile(new Projectile(state.type, textures_, data_, particleSystems_));
+			projectile->restore(state);
+			getLayer(UpperAir).attachChild(std::move(projectile));
+		}
+
+		for (const Pickup::Snapshot& state : snapshot.pickups)
+		{
+			std::unique_ptr<Pickup> pickup(new Pickup(state.type, textures_, data_));
+			pickup->restore(state);
+			getLayer(UpperAir).attachChild(std::move(pickup));
+		}
+
+		worldView_.setCenter(snapshot.viewCenter);
+		previousViewCenter_ = snapshot.viewCenter;
+		streamBackground();
+
+		level_.seek(snapshot.spawnCursor);
+		setRandomState(snapshot.random);
+		statistics_ = snapshot.statistics;
+	}
+
+	void World::populate(const Population & population)
+	{
+		const sf::FloatRect bounds = getViewBounds();
+		auto randomPosition = [&bounds]()
+		{
+			return sf::Vector2f(bounds.left + randomInt(static_cast<int>(bounds.width)),
+				bounds.top + randomInt(static_cast<int>(bounds.height)));
+		};
+		auto randomDirection = []()
+		{
+			float angle = toRadian(static_cast<float>(randomInt(360)));
+			return sf::Vector2f(std::cos(angle), std::sin(angle));
+		};
+
+		//the scenario has to survive every tick it is stepped for
+		assert(hasAlivePlayer());
+		getPlayer()->repair(std::numeric_limits<int>::max() / 2);
+
+		for (std::size_t i = 0; i < population.enemies; ++i)
+		{
+			AircraftType type = (i % 2 == 0) ? AircraftType::Raptor : AircraftType::Avenger;
+			std::unique_ptr<Aircraft> enemy(new Aircraft(type, textures_, data_, explosions_, labels_, timers_, particleSystems_, events_));
+			enemy->setPosition(randomPosition());
+			enemy->setRotation(180.f);
+			enemy->attachBehaviour(behaviours_);
+			getLayer(UpperAir).attachChild(std::move(enemy));
+		}
+
+		auto addProjectile = [&](Projectile::Type type)
+		{
+			std::unique_ptr<Projectile> projectile(new Projectile(type, textures_, data_, particleSystems_));
+			projectile->setPosition(randomPosition());
+			projectile->setVelocity(randomDirection() * projectile->getMaxSpeed());
+			getLayer(UpperAir).attachChild(std::move(projectile));
+		};
+
+		for (std::size_t i = 0; i < population.bullets; ++i)
+			addProjectile((i % 2 == 0) ? Projectile::Type::AlliedBullet : Projectile::Type::EnemyBullet);
+
+		for (std::size_t i = 0; i < population.missiles; ++i)
+			addProjectile(Projectile::Type::Missile);
+
+		for (std::size_t i = 0; i < population.pickups; ++i)
+		{
+			Pickup::Type type = static_cast<Pickup::Type>(randomInt(static_cast<int>(Pickup::Type::Count)));
+			std::unique_ptr<Pickup> pickup(new Pickup(type, textures_, data_));
+			pickup->setPosition(randomPosition());
+			getLayer(UpperAir).attachChild(std::move(pickup));
+		}
+
+		std::size_t particle = 0;
+		getLayer(LowerAir).forEachChild([&](SceneNode& node)
+		{
+			if (auto particles = dynamic_cast<ParticleNode*>(&node))
+			{
+				//split evenly between the systems
+				std::size_t share = population.particles / 2 + (particle++ == 0 ? population.particles % 2 : 0);
+				for (std::size_t i = 0; i < share; ++i)
+					particles->addParticle(randomPosition());
+			}
+		});
+	}
+
+	std::size_t World::getEntityCount() const
+	{
+		std::size_t count = 0;
+		getLayer(UpperAir).forEachChild([&count](const SceneNode& node)
+		{
+			if (!node.isDestroyed())
+				++count;
+		});
+
+		return count;
 	}
 
-	void World::loadTextures()
+	ParticleNode::Counters World::getParticleCounters() const
 	{
-		//textures_.load(TextureID::Eagle, "Media/Textures/Eagle.png");
-		//textures_.load(TextureID::Raptor, "Media/Textures/Raptor.png");
-		//textures_.load(TextureID::Avenger, "Media/Textures/Avenger.png");
-		//textures_.load(TextureID::Bullet, "Media/Textures/Bullet.png");
-		//textures_.load(TextureID::Missile, "Media/Textures/Missile.png");
-		//textures_.load(TextureID::HealthRefill, "Media/Textures/HealthRefill.png");
-		//textures_.load(TextureID::MissileRefill, "Media/Textures/MissileRefill.png");
-		//textures_.load(TextureID::FireRate, "Media/Textures/FireRate.png");
-		//textures_.load(TextureID::FireSpread, "Media/Textures/FireSpread.png");
-		textures_.load(TextureID::Jungle, "Media/Textures/JungleBig.png");
-		textures_.load(TextureID::Entities, "Media/Textures/Entities.png");
-		textures_.load(TextureID::Particle, "Media/Textures/Particle.png");
-		textures_.load(TextureID::Explosion, "Media/Textures/Explosion.png");
-		textures_.load(TextureID::FinishLine, "Media/Textures/FinishLine.png");
+		ParticleNode::Counters total;
+		for (std::size_t type = 0; type < static_cast<std::size_t>(Particle::Type::ParticleCount); ++type)
+		{
+			if (const ParticleNode* system = particleSystems_.find(static_cast<Particle::Type>(type)))
+			{
+				total.emitted += system->getCounters().emitted;
+				total.dropped += system->getCounters().dropped;
+				total.evicted += system->getCounters().evicted;
+			}
+		}
+
+		return total;
+	}
+
+	void World::setProfile(UpdateProfile * profile)
+	{
+		profile_ = profile;
+	}
+
+	void World::setCollisionMatrix(const CollisionMatrix & matrix)
+	{
+		collisionMatrix_ = matrix;
+	}
+
+	void World::setThreadPool(ThreadPool * threads, std::size_t minResponders)
+	{
+		threads_ = threads;
+		minParallelResponders_ = minResponders;
+	}
+
+	void World::markPhase(UpdateProfile::Phase phase)
+	{
+		if (!profile_)
+			return;
+
+		auto now = std::chrono::steady_clock::now();
+		std::size_t allocations = getAllocationCount();
+
+		profile_->nanoseconds[phase] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - phaseStart_).count();
+		profile_->allocations[phase] += allocations - phaseAllocations_;
+
+		//leave this bookkeeping out of the next phase
+		phaseStart_ = std::chrono::steady_clock::now();
+		phaseAllocations_ = allocations;
+	}
+
+	void World::applyQuality()
+	{
+		const QualityData& quality = QUALITY.at(qualityTier_);
+
+		if (bloomEffect_)
+		{
+			bloomEffect_->setBlurPasses(quality.bloomBlurPasses);
+			bloomEffect_->setSecondPassEnabled(quality.bloomSecondPass);
+		}
+		else if (cpuBloomEffect_)
+		{
+			cpuBloomEffect_->setBlurPasses(quality.bloomBlurPasses);
+			cpuBloomEffect_->setSecondPassEnabled(quality.bloomSecondPass);
+		}
+		labels_.setVisible(quality.showLabels);
+
+		Command particleQuality;
+		particleQuality.category = Category::Type::ParticleSystem;
+		particleQuality.action = derivedAction<ParticleNode>([quality](ParticleNode& particles, sf::Time)
+		{
+			std::size_t budget = PARTICLES.at(particles.getParticleType()).budget;
+
+			particles.setEmissionRate(quality.emissionRate);
+			particles.setBudget(static_cast<std::size_t>(budget * quality.particleBudget));
+		});
+
+		commandQueue_.push(particleQuality);
+	}
+
+	void World::loadTextures(TextureManager& textures)
+	{
+		//textures.load(TextureID::Eagle, "Media/Textures/Eagle.png");
+		//textures.load(TextureID::Raptor, "Media/Textures/Raptor.png");
+		//textures.load(TextureID::Avenger, "Media/Textures/Avenger.png");
+		//textures.load(TextureID::Bullet, "Media/Textures/Bullet.png");
+		//textures.load(TextureID::Missile, "Media/Textures/Missile.png");
+		//textures.load(TextureID::HealthRefill, "Media/Textures/HealthRefill.png");
+		//textures.load(TextureID::MissileRefill, "Media/Textures/MissileRefill.png");
+		//textures.load(TextureID::FireRate, "Media/Textures/FireRate.png");
+		//textures.load(TextureID::FireSpread, "Media/Textures/FireSpread.png");
+		textures.load(TextureID::Jungle, "Media/Textures/JungleBig.png");	//repeated, so kept out of the atlas
+
+		textures.loadToAtlas(TextureID::Entities, "Media/Textures/Entities.png");
+		textures.loadToAtlas(TextureID::Particle, "Media/Textures/Particle.png");
+		textures.loadToAtlas(TextureID::Explosion, "Media/Textures/Explosion.png");
+		textures.loadToAtlas(TextureID::FinishLine, "Media/Textures/FinishLine.png");
+		textures.packAtlas();
+
+		textures.get(TextureID::Jungle).texture->setRepeated(true);
 	}
 
 	void World::buildScene()
@@ -187,139 +593,202 @@ namespace GEX {
 		{
 			auto category = (i == UpperAir) ? Category::Type::AirSceneLayer : Category::Type::None;
 			SceneNode::Ptr layer(new SceneNode(category));
-			sceneLayers_.push_back(layer.get()); //raw pointers
+			sceneLayers_.push_back(layer->getHandle());
 			sceneGraph_.attachChild(std::move(layer));
 		}
 
 		//Particle Systems
 		std::unique_ptr<ParticleNode> smoke(new ParticleNode(Particle::Type::Smoke, textures_));
-		sceneLayers_[LowerAir]->attachChild(std::move(smoke));
+		particleSystems_.add(*smoke);
+		getLayer(LowerAir).attachChild(std::move(smoke));
 
 		std::unique_ptr<ParticleNode> fire(new ParticleNode(Particle::Type::Propellant, textures_));
-		sceneLayers_[LowerAir]->attachChild(std::move(fire));
+		particleSystems_.add(*fire);
+		getLayer(LowerAir).attachChild(std::move(fire));
 
-		//sound effects
-		std::unique_ptr<SoundNode> sNode(new SoundNode(sounds_));
-		sceneGraph_.attachChild(std::move(sNode));
+		//explosion effects shared by all aircraft
+		explosions_.setTexture(textures_.get(TextureID::Explosion));
 
 		//background
-		sf::Texture& texture = textures_.get(TextureID::Jungle);
-		sf::IntRect textureRect(worldBounds_);
-		texture.setRepeated(true);
+		const sf::Texture& texture = *textures_.get(TextureID::Jungle).texture;
 
-		std::unique_ptr<SpriteNode> backgroundSprite(
-			new SpriteNode(texture, textureRect));
+		std::unique_ptr<BackgroundNode> backgroundSprite(new BackgroundNode(texture, worldBounds_.width));
 		backgroundSprite->setPosition(worldBounds_.left, worldBounds_.top);
-		sceneLayers_[Background]->attachChild(std::move(backgroundSprite));
+		background_ = backgroundSprite->getHandle();
+		getLayer(Background).attachChild(std::move(backgroundSprite));
 
 		// Finish line
-		sf::Texture&		finishLinetexture = textures_.get(TextureID::FinishLine);
-		finishLinetexture.setRepeated(false);
+		TextureRegion		finishLinetexture = textures_.get(TextureID::FinishLine);
 		sf::IntRect			textureRect2(0.f, 0.f, worldView_.getSize().x, 50.f);
 
-		std::unique_ptr<SpriteNode>	finishLineSprite(new SpriteNode(finishLinetexture, textureRect2));
+		std::unique_ptr<SpriteNode>	finishLineSprite(new SpriteNode(*finishLinetexture.texture, finishLinetexture.map(textureRect2)));
 
 		finishLineSprite->setPosition(worldBounds_.top, worldBounds_.top);
-		finishLine_ = finishLineSprite.get();
-		sceneLayers_[LowerAir]->attachChild(std::move(finishLineSprite));
+		finishLine_ = finishLineSprite->getHandle();
+		getLayer(LowerAir).attachChild(std::move(finishLineSprite));
 
 		//add player aircraft & game objects
-		std::unique_ptr<Aircraft> leader(new Aircraft(AircraftType::Eagle, textures_));
+		std::unique_ptr<Aircraft> leader(new Aircraft(AircraftType::Eagle, textures_, data_, explosions_, labels_, timers_, particleSystems_, events_));
 		leader->setPosition(spawnPosition_);
 		leader->setVelocity(50.f, scrollSpeed_);
-		playerAircraft_ = leader.get();
-		sceneLayers_[UpperAir]->attachChild(std::move(leader));
+		playerAircraft_ = leader->getHandle();
+		getLayer(UpperAir).attachChild(std::move(leader));
 
-		//Add enemy aircrafts
-		addEnemies();
 	}
 
 
-	bool matchesCategories(SceneNode::Pair& colliders, Category::Type type1, Category::Type type2)
+	void World::subscribeToEvents()
 	{
-		unsigned int category1 = colliders.first->getCategory();
-		unsigned int category2 = colliders.second->getCategory();
-
-		//Make sure first pair entry has catgeory type1 and seconds has type2
-		if (type1 & category1 && type2 & category2)
+		//statistics, the same whether or not anyone is watching
+		events_.subscribe(GameplayEvent::Type::Damaged, [this](const GameplayEventBus::Batch& events)
 		{
-			return true;
-		}
-		else if (type1 & category2 && type2 & category1)
+			for (const GameplayEvent& event : events)
+			{
+				if (event.category & Category::Type::PlayerAircraft)
+					statistics_.damageTaken += event.value;
+			}
+		});
+		events_.subscribe(GameplayEvent::Type::Destroyed, [this](const GameplayEventBus::Batch& events)
 		{
-			std::swap(colliders.first, colliders.second);
-			return true;
-		}
-		else 
+			for (const GameplayEvent& event : events)
+			{
+				if (event.category & Category::Type::EnemyAircraft)
+					++statistics_.enemiesDestroyed;
+			}
+		});
+		events_.subscribe(GameplayEvent::Type::PickupCollected, [this](const GameplayEventBus::Batch& events)
 		{
-			return false;
-		}
-	}
-
-	void World::addEnemies()
-	{
-		addEnemy(AircraftType::Raptor, -250.f, 200.f);
-		addEnemy(AircraftType::Raptor, 0.f, 200.f);
-		addEnemy(AircraftType::Raptor, +250.f, 200.f);
+			statistics_.pickupsCollected += static_cast<int>(events.size());
+		});
+		events_.subscribe(GameplayEvent::Type::ShotFired, [this](const GameplayEventBus::Batch& events)
+		{
+			statistics_.shotsFired += static_cast<int>(events.size());
+		});
 
-		addEnemy(AircraftType::Raptor, -250.f, 600.f);
-		addEnemy(AircraftType::Raptor, 0.f, 600.f);
-		addEnemy(AircraftType::Raptor, +250.f, 600.f);
+		//a puff of smoke where each aircraft went down
+		events_.subscribe(GameplayEvent::Type::Destroyed, [this](const GameplayEventBus::Batch& events)
+		{
+			ParticleNode* smoke = particleSystems_.find(Particle::Type::Smoke);
+			if (!smoke)
+				return;
 
-		addEnemy(AircraftType::Avenger, -70.f, 400.f);
-		addEnemy(AircraftType::Avenger, 70.f, 400.f);
+			for (const GameplayEvent& event : events)
+			{
+				for (int i = 0; i < DESTROYED_SMOKE_PARTICLES; ++i)
+				{
+					smoke->addParticle(event.position);
+				}
+			}
+		});
 
-		addEnemy(AircraftType::Avenger, -70.f, 800.f);
-		addEnemy(AircraftType::Avenger, 70.f, 800.f);
+		//headless Worlds have no sounds to play
+		if (!sounds_)
+			return;
 
-		addEnemy(AircraftType::Avenger, -120.f, 850.f);
-		addEnemy(AircraftType::Avenger, 120.f, 850.f);
+		events_.subscribe(GameplayEvent::Type::ShotFired, [this](const GameplayEventBus::Batch& events)
+		{
+			for (const GameplayEvent& event : events)
+			{
+				SoundEffectID effect = SoundEffectID::EnemyGunFire;
+				if (event.value == static_cast<int>(Projectile::Type::Missile))
+					effect = SoundEffectID::LaunchMissile;
+				else if (event.value == static_cast<int>(Projectile::Type::AlliedBullet))
+					effect = SoundEffectID::AlliedGunFire;
 
-		addEnemy(AircraftType::Raptor, -250.f, 900.f);
-		addEnemy(AircraftType::Raptor, 0.f, 900.f);
-		addEnemy(AircraftType::Raptor, +250.f, 900.f);
+				sounds_->play(effect, event.position);
+			}
+		});
+		events_.subscribe(GameplayEvent::Type::Destroyed, [this](const GameplayEventBus::Batch& events)
+		{
+			for (const GameplayEvent& event : events)
+			{
+				SoundEffectID effect = (randomInt(2) == 0 ? SoundEffectID::Explosion1 : SoundEffectID::Explosion2);
+				sounds_->play(effect, event.position);
+			}
+		});
+		events_.subscribe(GameplayEvent::Type::PickupCollected, [this](const GameplayEventBus::Batch& events)
+		{
+			for (const GameplayEvent& event : events)
+			{
+				sounds_->play(SoundEffectID::CollectPickup, event.position);
+			}
+		});
+	}
 
-		addEnemy(AircraftType::Raptor, -250.f, 950.f);
-		addEnemy(AircraftType::Raptor, 0.f, 9500.f);
-		addEnemy(AircraftType::Raptor, +250.f, 1000.f);
+	void World::prepareLevel()
+	{
+		//compile the authored level when it is new or has been edited since, checked once
+		//per run so batch and benchmark Worlds do not reread the text each time
+		static std::once_flag checked;
+		std::call_once(checked, []()
+		{
+			if (!isLevelCurrent(LEVEL_PATH + ".txt", LEVEL_PATH + ".lvl"))
+			{
+				compileLevel(LEVEL_PATH + ".txt", LEVEL_PATH + ".lvl");
+			}
+		});
+	}
 
-		addEnemy(AircraftType::Avenger, -70.f, 1050.f);
-		addEnemy(AircraftType::Avenger, 70.f, 1100.f);
+	void World::prepareHeadless(TextureManager & textures)
+	{
+		//Application loads the font for the game, headless runs never build one
+		if (!FontManager::getInstance().isLoaded(FontID::Main))
+			FontManager::getInstance().load(FontID::Main, "Media/Sansation.ttf");
 
-		addEnemy(AircraftType::Avenger, -70.f, 1200.f);
-		addEnemy(AircraftType::Avenger, 70.f, 1250.f);
+		loadTextures(textures);
+		prepareLevel();
+	}
 
-		addEnemy(AircraftType::Avenger, -120.f, 1250.f);
-		addEnemy(AircraftType::Avenger, 120.f, 1300.f);
+	void World::loadLevel()
+	{
+		prepareLevel();
 
-		std::sort(enemySpawnPoints_.begin(), enemySpawnPoints_.end(), [](SpawnPoint lhs, SpawnPoint rhs) 
+		if (!level_.open(LEVEL_PATH + ".lvl"))
 		{
-			return lhs.y < rhs.y;
-		});
-	}
+			throw std::runtime_error("Level load failed " + LEVEL_PATH);
+		}
 
-	void World::addEnemy(AircraftType type, float relX, float relY)
-	{
-		SpawnPoint spawnPoint(type, spawnPosition_.x + relX, spawnPosition_.y - relY);
-		enemySpawnPoints_.push_back(spawnPoint);
+		worldBounds_.height = level_.getLength();
+		spawnPosition_.y = worldBounds_.height - worldView_.getSize().y / 2.f;
 	}
 
 	void World::spawnEnemies()
 	{
-		while (!enemySpawnPoints_.empty() && 
-			enemySpawnPoints_.back().y > getBattlefieldBounds().top)
+		//spawns are sorted by distance, so stop at the first one still ahead of the battlefield
+		while (level_.hasNext() &&
+			spawnPosition_.y - level_.peek().distance > getBattlefieldBounds().top)
 		{
-			auto spawnPoint = enemySpawnPoints_.back();
-			std::unique_ptr<Aircraft> enemy(new Aircraft(spawnPoint.type, textures_));
+			const SpawnRecord& spawnPoint = level_.peek();
+			std::unique_ptr<Aircraft> enemy(new Aircraft(spawnPoint.type, textures_, data_, explosions_, labels_, timers_, particleSystems_, events_));
 
-			enemy->setPosition(spawnPoint.x, spawnPoint.y);
+			enemy->setPosition(spawnPosition_.x + spawnPoint.x, spawnPosition_.y - spawnPoint.distance);
 			enemy->setRotation(180.f);
-			sceneLayers_[UpperAir]->attachChild(std::move(enemy));
+			enemy->attachBehaviour(behaviours_);
+			getLayer(UpperAir).attachChild(std::move(enemy));
 
-			enemySpawnPoints_.pop_back();
+			level_.pop();
 		}
 	}
 
+	Aircraft * World::getPlayer() const
+	{
+		return SceneNode::resolve<Aircraft>(playerAircraft_);
+	}
+
+	void World::streamBackground()
+	{
+		if (BackgroundNode* background = SceneNode::resolve<BackgroundNode>(background_))
+			background->setViewBounds(getViewBounds());
+	}
+
+	SceneNode & World::getLayer(Layer layer) const
+	{
+		SceneNode* node = SceneNode::resolve(sceneLayers_[layer]);
+		assert(node != nullptr);
+
+		return *node;
+	}
+
 	sf::FloatRect World::getViewBounds() const
 	{
 		//returns a floatrect
@@ -334,6 +803,18 @@ namespace GEX {
 
 		return bounds;
 	}
+
+	sf::FloatRect World::getActivityBounds() const
+	{
+		sf::FloatRect bounds = getViewBounds();
+		bounds.left -= activityMargin_;
+		bounds.top -= activityMargin_;
+		bounds.width += 2.f * activityMargin_;
+		bounds.height += 2.f * activityMargin_;
+
+		return bounds;
+	}
+
 	void World::guideMissiles()
 	{
 		// build a list of active enemies
@@ -342,7 +823,7 @@ namespace GEX {
 		enemyCollector.action = derivedAction<Aircraft>([this](Aircraft& enemy, sf::Time dt)
 		{
 			if (!enemy.isDestroyed())
-				activeEnemies_.push_back(&enemy);
+				activeEnemies_.push_back(enemy.getHandle());
 		});
 
 		Command missileGuider;
@@ -356,8 +837,12 @@ namespace GEX {
 			float minDistance = std::numeric_limits<float>::max();
 			Aircraft* closestEnemy = nullptr;
 
-			for (Aircraft* e : activeEnemies_)
+			for (Handle handle : activeEnemies_)
 			{
+				Aircraft* e = SceneNode::resolve<Aircraft>(handle);
+				if (!e)
+					continue;
+
 				auto d = distance(missile, *e);
 				if (d < minDistance)
 				{
@@ -374,41 +859,226 @@ namespace GEX {
 		activeEnemies_.clear();
 
 	}
+	void World::updateBoundingBoxes()
+	{
+		getLayer(UpperAir).forEachChild([](SceneNode& node)
+		{
+			if (auto entity = dynamic_cast<Entity*>(&node))
+				entity->updateBoundingBox();
+		});
+	}
+
 	void World::handleCollisions()
 	{
-		// build a list of colliding pairs of SceneNodes
-		std::set<SceneNode::Pair> collisionPairs;
-		sceneGraph_.checkSceneCollision(sceneGraph_, collisionPairs);
+		//gather the cached boxes into one array, entities spawned by this tick's
+		//commands compute theirs on first use
+		colliders_.clear();
+		getLayer(UpperAir).forEachChild([this](SceneNode& node)
+		{
+			auto entity = dynamic_cast<Entity*>(&node);
+			if (!entity || entity->isDestroyed())
+				return;
+
+			//entities that collide with nothing never enter the broad phase
+			unsigned int category = entity->getCategory();
+			unsigned int mask = collisionMatrix_.getMask(category);
+			if (mask != 0)
+				colliders_.push_back({ entity->getBoundingBox(), category, mask, !entity->getOrientedBox().isAxisAligned, entity });
+		});
 
-		for (SceneNode::Pair pair : collisionPairs)
+		// build the contacts, each pair visited once and filtered before the bounds test,
+		// rotated entities then get the exact test on the few pairs whose bounds overlap
+		contacts_.clear();
+		std::size_t overlaps = 0;
+		std::size_t orientedTests = 0;
+		std::size_t orientedRejections = 0;
+		for (std::size_t i = 0; i < colliders_.size(); ++i)
 		{
-			if (matchesCategories(pair, Category::Type::PlayerAircraft, Category::Type::EnemyAircraft))
+			const Collider& collider = colliders_[i];
+			for (std::size_t j = i + 1; j < colliders_.size(); ++j)
 			{
-				auto& player = static_cast<Aircraft&>(*pair.first);
-				auto& enemy = static_cast<Aircraft&>(*pair.second);
+				const Collider& other = colliders_[j];
+				if ((collider.mask & other.category) == 0 || !collider.bounds.intersects(other.bounds))
+					continue;
 
-				player.damage(enemy.getHitPoints());
-				enemy.destroy();
+				++overlaps;
+				if (collider.isRotated || other.isRotated)
+				{
+					++orientedTests;
+					if (!intersects(collider.entity->getOrientedBox(), other.entity->getOrientedBox()))
+					{
+						++orientedRejections;
+						continue;
+					}
+				}
+
+				addContact(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j));
 			}
-			else if (matchesCategories(pair, Category::Type::PlayerAircraft, Category::Type::Pickup))
+		}
+
+		if (profile_)
+		{
+			profile_->boundsOverlaps += overlaps;
+			profile_->orientedTests += orientedTests;
+			profile_->orientedRejections += orientedRejections;
+		}
+
+		//group by type, then by aircraft so each one's contacts are adjacent
+		std::sort(contacts_.begin(), contacts_.end(), [](const Contact& lhs, const Contact& rhs)
+		{
+			return std::tie(lhs.type, lhs.first, lhs.second) < std::tie(rhs.type, rhs.first, rhs.second);
+		});
+		contacts_.erase(std::unique(contacts_.begin(), contacts_.end(), [](const Contact& lhs, const Contact& rhs)
+		{
+			return lhs.type == rhs.type && lhs.first == rhs.first && lhs.second == rhs.second;
+		}), contacts_.end());
+
+		std::array<std::size_t, Contact::TypeCount + 1> groups;
+		for (int type = 0; type <= Contact::TypeCount; ++type)
+		{
+			groups[type] = std::lower_bound(contacts_.begin(), contacts_.end(), type, [](const Contact& contact, int type)
 			{
-				auto& player = static_cast<Aircraft&>(*pair.first);
-				auto& pickup = static_cast<Pickup&>(*pair.second);
+				return contact.type < type;
+			}) - contacts_.begin();
+		}
 
-				pickup.apply(player);
-				pickup.destroy();
-				player.playLocalSound(commandQueue_, SoundEffectID::CollectPickup);
+		resolveRams(groups[Contact::Ram], groups[Contact::Ram + 1]);
+		resolvePickups(groups[Contact::Collect], groups[Contact::Collect + 1]);
+		resolveHits(groups[Contact::Hit], groups[Contact::Hit + 1]);
+	}
 
+	void World::addContact(std::uint32_t collider1, std::uint32_t collider2)
+	{
+		struct Rule
+		{
+			Contact::Type			type;
+			unsigned int			first;
+			unsigned int			second;
+		};
+
+		static const Rule RULES[] = {
+			{ Contact::Ram, Category::PlayerAircraft, Category::EnemyAircraft },
+			{ Contact::Collect, Category::PlayerAircraft, Category::Pickup },
+			{ Contact::Hit, Category::PlayerAircraft, Category::EnemyProjectile },
+			{ Contact::Hit, Category::EnemyAircraft, Category::AlliedProjectile },
+		};
+
+		//pairs no rule covers can still be let through by a custom matrix, they get no response
+		unsigned int category1 = colliders_[collider1].category;
+		unsigned int category2 = colliders_[collider2].category;
+		for (const Rule& rule : RULES)
+		{
+			if (rule.first & category1 && rule.second & category2)
+			{
+				contacts_.push_back({ rule.type, collider1, collider2 });
+				return;
 			}
-			else if(matchesCategories(pair, Category::Type::PlayerAircraft, Category::Type::EnemyProjectile) ||
-				matchesCategories(pair, Category::Type::EnemyAircraft, Category::Type::AlliedProjectile))
+			if (rule.first & category2 && rule.second & category1)
+			{
+				contacts_.push_back({ rule.type, collider2, collider1 });
+				return;
+			}
+		}
+	}
+
+	void World::resolveRams(std::size_t begin, std::size_t end)
+	{
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			const Collider& playerCollider = colliders_[contacts_[i].first];
+			const Collider& enemyCollider = colliders_[contacts_[i].second];
+			auto& player = static_cast<Aircraft&>(*playerCollider.entity);
+			auto& enemy = static_cast<Aircraft&>(*enemyCollider.entity);
+
+			//a second ram in the same tick finds the enemy already gone
+			int damage = enemy.getHitPoints();
+			if (damage <= 0)
+				continue;
+
+			bool wasAlive = !player.isDestroyed();
+			player.damage(damage);
+			enemy.destroy();
+
+			events_.publish({ GameplayEvent::Type::Damaged, playerCollider.category, player.getWorldPosition(), damage });
+			events_.publish({ GameplayEvent::Type::Destroyed, enemyCollider.category, enemy.getWorldPosition(), 0 });
+			if (wasAlive && player.isDestroyed())
+				events_.publish({ GameplayEvent::Type::Destroyed, playerCollider.category, player.getWorldPosition(), 0 });
+		}
+	}
+
+	void World::resolvePickups(std::size_t begin, std::size_t end)
+	{
+		//pickups change the player in arbitrary ways, so these stay in order on this thread
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			auto& player = static_cast<Aircraft&>(*colliders_[contacts_[i].first].entity);
+			auto& pickup = static_cast<Pickup&>(*colliders_[contacts_[i].second].entity);
+
+			pickup.apply(player);
+			pickup.destroy();
+
+			events_.publish({ GameplayEvent::Type::PickupCollected, colliders_[contacts_[i].second].category,
+				player.getWorldPosition(), static_cast<int>(pickup.getType()) });
+		}
+	}
+
+	void World::resolveHits(std::size_t begin, std::size_t end)
+	{
+		if (begin == end)
+			return;
+
+		//sum the damage per aircraft and mark the projectiles spent
+		responses_.assign(colliders_.size(), Response{ 0, false, false });
+		responders_.clear();
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			const Contact& contact = contacts_[i];
+			auto& projectile = static_cast<Projectile&>(*colliders_[contact.second].entity);
+
+			if (responses_[contact.first].damage == 0)
+				responders_.push_back(contact.first);
+			responses_[contact.first].damage += projectile.getDamage();
+
+			if (!responses_[contact.second].isHit)
+				responders_.push_back(contact.second);
+			responses_[contact.second].isHit = true;
+		}
+
+		//each responder is a different entity, so the apply pass splits freely
+		auto apply = [this](std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
 			{
-				auto& aircraft = static_cast<Aircraft&>(*pair.first);
-				auto& projectile = static_cast<Projectile&>(*pair.second);
+				Response& response = responses_[responders_[i]];
+				Entity& entity = *colliders_[responders_[i]].entity;
 
-				aircraft.damage(projectile.getDamage());
-				projectile.destroy();
+				if (response.isHit)
+					entity.destroy();
+				if (response.damage > 0)
+				{
+					bool wasAlive = !entity.isDestroyed();
+					entity.damage(response.damage);
+					response.isKilled = wasAlive && entity.isDestroyed();
+				}
 			}
+		};
+		if (threads_ && responders_.size() >= minParallelResponders_)
+			threads_->parallelFor(responders_.size(), apply);
+		else
+			apply(0, responders_.size());
+
+		//published here rather than in the apply pass, the bus is only appended to from this thread
+		for (std::uint32_t index : responders_)
+		{
+			const Response& response = responses_[index];
+			if (response.damage == 0)
+				continue;
+
+			const Collider& collider = colliders_[index];
+			sf::Vector2f position = collider.entity->getWorldPosition();
+			events_.publish({ GameplayEvent::Type::Damaged, collider.category, position, response.damage });
+			if (response.isKilled)
+				events_.publish({ GameplayEvent::Type::Destroyed, collider.category, position, 0 });
 		}
 	}
-}
\ No newline at end of file
+}
@@ -33,11 +33,28 @@
 #include <SFML/Graphics/Texture.hpp>
 #include "SceneNode.h"
 #include "SpriteNode.h"
+#include "BackgroundNode.h"
 #include "TextureManager.h"
 #include "Aircraft.h"
 #include "CommandQueue.h"
 #include "BloomEffect.h"
+#include "CpuBloomEffect.h"
 #include "SoundPlayer.h"
+#include "ExplosionPool.h"
+#include "TextBatch.h"
+#include "QualityGovernor.h"
+#include "LevelFile.h"
+#include "WorldSnapshot.h"
+#include "DataTables.h"
+#include "BehaviourScheduler.h"
+#include "ParticleRegistry.h"
+#include "ParticleNode.h"
+#include "CollisionMatrix.h"
+#include "GameplayEventBus.h"
+#include "ThreadPool.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
 
 namespace sf {
 	class RenderTarget;
@@ -45,37 +62,109 @@ namespace sf {
 
 namespace GEX 
 {
+	//time and allocations spent in each part of World::update, summed over ticks
+	struct UpdateProfile
+	{
+		enum Phase
+		{
+			Scroll = 0,
+			Commands,
+			Collisions,
+			Wrecks,
+			SceneUpdate,
+			Spawning,
+			PhaseCount
+		};
+
+		std::size_t								ticks = 0;
+		std::array<long long, PhaseCount>		nanoseconds{};
+		std::array<std::size_t, PhaseCount>		allocations{};
+		std::size_t								boundsOverlaps = 0;		//pairs past the broad phase
+		std::size_t								orientedTests = 0;		//of those, pairs needing the separating axis test
+		std::size_t								orientedRejections = 0;	//of those, pairs it separated
+	};
+
 	class World
 	{
 	public:
 
-		explicit					World(sf::RenderTarget& outputTarget, SoundPlayer& sounds);
+		typedef WorldStatistics		Statistics;	//lives with the snapshot so a retry can rewind it
+
+		//synthetic load for benchmarks, scattered over the view
+		struct Population
+		{
+			std::size_t				enemies;
+			std::size_t				bullets;	//half allied, half enemy
+			std::size_t				missiles;	//guided, with smoke and propellant emitters
+			std::size_t				pickups;
+			std::size_t				particles;	//half smoke, half propellant
+		};
+
+	public:
+		static const std::size_t	DEFAULT_PARALLEL_RESPONDERS = 512;	//hits in one tick before the apply pass is split
+
+		explicit					World(sf::RenderTarget& outputTarget, SoundPlayer& sounds, RenderTargetPool& renderTargets, ThreadPool& threads);
+									//headless: no drawing, sound or post effects, call prepareHeadless first
+									World(sf::Vector2f viewSize, const TextureManager& textures, const GameData& data);
+
+		static void					loadTextures(TextureManager& textures);
+		static void					prepareLevel();	//compile the level if needed, checked once per run
+		static void					prepareHeadless(TextureManager& textures);	//textures, label font and level, for headless runs
 		void						update(sf::Time dt, CommandQueue& commands);  //update world
 		void						adaptPlayerVelocity(); //adapt player's velocity to be same 
 		void						adaptPlayerPosition();	//adapt player's position to within the screen bounds
-		void						draw();
+		void						draw(float alpha = 1.f);	//alpha blends last tick into this one
 
 		CommandQueue&				getCommandQueue();	//returns command queue
 
 		bool						hasAlivePlayer() const;
 		bool						hasPlayerReachedEnd() const;
 		void						destroyOutOfViewEntities();
+									//enemies further than margin from the view update every nth tick, 0 puts them to sleep
+		void						setActivityBand(float margin, unsigned int inactiveTickInterval);
 		void						updateSounds();
 
+		void						setQualityTier(QualityTier tier);	//scale bloom, particles and labels
+		const Statistics&			getStatistics() const;
+
+		void						saveSnapshot(WorldSnapshot& snapshot) const;	//player must be alive
+		void						restoreSnapshot(const WorldSnapshot& snapshot);	//particles and sounds are left as they are
+
+		void						populate(const Population& population);	//also makes the player indestructible
+		std::size_t					getEntityCount() const;	//live entities in the air layer
+		ParticleNode::Counters		getParticleCounters() const;	//summed over the particle systems
+		void						setProfile(UpdateProfile* profile);	//null to stop profiling
+		void						setCollisionMatrix(const CollisionMatrix& matrix);	//pairs outside it are never tested
+									//hit responses split over threads once a tick has minResponders, null keeps them serial
+		void						setThreadPool(ThreadPool* threads, std::size_t minResponders = DEFAULT_PARALLEL_RESPONDERS);
+
 	private:
-		void						loadTextures();  //load textures 
+									//everything both public constructors share, null textures means load its own
+									World(sf::Vector2f viewSize, const TextureManager* textures, const GameData& data,
+										sf::RenderTarget* target, SoundPlayer* sounds, RenderTargetPool* renderTargets, ThreadPool* threads);
+
 		void						buildScene();	//init layers, background and players
+		void						subscribeToEvents();	//statistics, sounds and effects
 			
-						//Adds spawn points where enemies will spawn (contains aircraft type and locations)
-		void						addEnemies();   
-		void						addEnemy(AircraftType type, float x, float y);
+		void						loadLevel();	//level length and the spawn stream
 		void						spawnEnemies();
 
+		Aircraft*					getPlayer() const;	//null once the player's wreck is gone
+		void						streamBackground();	//load the background chunks around the view
 		sf::FloatRect				getViewBounds() const;
 		sf::FloatRect				getBattlefieldBounds() const;
+		sf::FloatRect				getActivityBounds() const;
+		void						scheduleActivity();
 
+		void						applyQuality();
 		void						guideMissiles();
+		void						updateBoundingBoxes();	//once per tick, after integration
 		void						handleCollisions();
+		void						addContact(std::uint32_t collider1, std::uint32_t collider2);
+		void						resolveRams(std::size_t begin, std::size_t end);
+		void						resolvePickups(std::size_t begin, std::size_t end);
+		void						resolveHits(std::size_t begin, std::size_t end);
+		void						markPhase(UpdateProfile::Phase phase);	//charge the time since the last mark
 
 	private:
 		enum Layer
@@ -86,38 +175,82 @@ namespace GEX
 			LayerCount
 		};
 
-		struct SpawnPoint
+		SceneNode&					getLayer(Layer layer) const;
+
+		struct Collider
+		{
+			sf::FloatRect			bounds;
+			unsigned int			category;
+			unsigned int			mask;		//categories it can collide with
+			bool					isRotated;	//bounds alone are too generous, test the oriented box
+			Entity*					entity;
+		};
+
+		struct Contact
 		{
-			SpawnPoint(AircraftType _type, float _relX, float _relY)
-				: type(_type)
-				, x(_relX)
-				, y(_relY)
-			{}
-
-			AircraftType			type;
-			float					x;
-			float					y;
+			enum Type
+			{
+				Ram,		//player and enemy aircraft
+				Collect,	//player and pickup
+				Hit,		//aircraft and hostile projectile
+				TypeCount
+			};
+
+			Type					type;
+			std::uint32_t			first;		//collider index, always the aircraft
+			std::uint32_t			second;
 		};
 
+		struct Response
+		{
+			int						damage;		//summed over every hit this tick
+			bool					isHit;		//projectile spent
+			bool					isKilled;	//destroyed by this tick's damage
+		};
 
 	private:
-		sf::RenderTarget&			target_;
-		sf::RenderTexture			sceneTexture_;
+		sf::RenderTarget*			target_;		//null when headless
+		RenderTargetPool*			renderTargets_;	//shared with other Worlds, scene texture borrowed per frame
+		ThreadPool*					threads_;		//null when headless, unless given one
+		std::size_t					minParallelResponders_;
 		
 		sf::View					worldView_;
-		TextureManager				textures_;
+		sf::Vector2f				previousViewCenter_;	//view centre at the start of the tick
+		TextureManager				ownTextures_;	//unused when textures are shared
+		const TextureManager&		textures_;
+		GameData					data_;
+		ExplosionPool				explosions_;	//must outlive sceneGraph_
+		TextBatch					labels_;		//all entity labels, drawn in one call
+		BehaviourScheduler			behaviours_;	//enemy scripts, must outlive sceneGraph_
+		TimerWheel					timers_;		//cooldowns and other timed events, must outlive sceneGraph_
+		ParticleRegistry			particleSystems_;	//looked up by emitters, must outlive sceneGraph_
+		GameplayEventBus			events_;		//dispatched at the end of each tick, must outlive sceneGraph_
 		SceneNode					sceneGraph_;
-		std::vector<SceneNode*>		sceneLayers_;
+		std::vector<Handle>			sceneLayers_;
 		sf::FloatRect				worldBounds_;
 		sf::Vector2f				spawnPosition_;
 		float						scrollSpeed_;
-		Aircraft*					playerAircraft_;
+		float						activityMargin_;
+		unsigned int				inactiveTickInterval_;
+		Handle						playerAircraft_;	//stale once the wreck is removed
+		Handle						background_;
 		CommandQueue				commandQueue_;
-		std::vector<SpawnPoint>		enemySpawnPoints_;
-		std::vector<Aircraft*>		activeEnemies_;
-		BloomEffect					bloomEffect_;
-		SpriteNode*					finishLine_;
-		SoundPlayer&				sounds_;
+		LevelStream					level_;
+		std::vector<Handle>			activeEnemies_;
+		std::vector<Collider>		colliders_;			//broad phase input, reused every tick
+		std::vector<Contact>		contacts_;			//broad phase output, reused every tick
+		std::vector<Response>		responses_;			//by collider index
+		std::vector<std::uint32_t>	responders_;		//colliders with a response this tick
+		CollisionMatrix				collisionMatrix_;
+		std::unique_ptr<BloomEffect>	bloomEffect_;		//only one of the two is created,
+		std::unique_ptr<CpuBloomEffect>	cpuBloomEffect_;	//the CPU one when shaders are unsupported
+		Handle						finishLine_;
+		SoundPlayer*				sounds_;		//null when headless
+		QualityTier					qualityTier_;
+		Statistics					statistics_;
+		UpdateProfile*				profile_;
+		std::chrono::steady_clock::time_point	phaseStart_;
+		std::size_t					phaseAllocations_;
 	};
 
 }
@@ -0,0 +1,80 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#include "WorldSnapshot.h"
+#include <cassert>
+
+namespace GEX {
+
+	SnapshotRing::SnapshotRing(std::size_t capacity)
+		: slots_(capacity)
+		, next_(0)
+		, size_(0)
+	{
+		assert(capacity > 0);
+	}
+
+	WorldSnapshot & SnapshotRing::push()
+	{
+		WorldSnapshot& slot = slots_[next_];
+
+		next_ = (next_ + 1) % slots_.size();
+		if (size_ < slots_.size())
+			++size_;
+
+		return slot;
+	}
+
+	const WorldSnapshot & SnapshotRing::get(std::size_t ticksAgo) const
+	{
+		assert(ticksAgo < size_);
+		return slots_[(next_ + slots_.size() - 1 - ticksAgo) % slots_.size()];
+	}
+
+	const WorldSnapshot & SnapshotRing::oldest() const
+	{
+		return get(size_ - 1);
+	}
+
+	std::size_t SnapshotRing::size() const
+	{
+		return size_;
+	}
+
+	bool SnapshotRing::isEmpty() const
+	{
+		return size_ == 0;
+	}
+
+	void SnapshotRing::clear()
+	{
+		next_ = 0;
+		size_ = 0;
+	}
+}
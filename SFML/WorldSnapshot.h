@@ -0,0 +1,83 @@
+/**
+*
+* @author Courtney Diotte
+*
+* @version 1.0
+* *
+* @section DESCRIPTION
+* Aircraft shooter game
+*
+* @section LICENSE
+* *
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+
+#pragma once
+#include "Aircraft.h"
+#include "Projectile.h"
+#include "Pickup.h"
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <random>
+#include <vector>
+
+namespace GEX {
+
+	//the run so far, for the game over screen and balance sweeps
+	struct WorldStatistics
+	{
+		sf::Time							timeAlive;
+		int									damageTaken;
+		int									pickupsCollected;
+		int									enemiesDestroyed;
+		int									shotsFired;		//bullet volleys and missiles, player and enemies alike
+	};
+
+	//everything needed to put a World back to the start of a tick,
+	//vectors keep their capacity so saving into a reused snapshot does not allocate
+	struct WorldSnapshot
+	{
+		std::vector<Aircraft::Snapshot>		aircraft;		//player first
+		std::vector<Projectile::Snapshot>	projectiles;
+		std::vector<Pickup::Snapshot>		pickups;
+		sf::Vector2f						viewCenter;
+		std::size_t							spawnCursor;	//spawns already taken from the level
+		std::default_random_engine			random;
+		WorldStatistics						statistics;		//so a retry drops what the discarded ticks counted
+	};
+
+	//the last few snapshots, oldest overwritten first
+	class SnapshotRing
+	{
+	public:
+		explicit							SnapshotRing(std::size_t capacity);
+
+		WorldSnapshot&						push();		//slot to save the next snapshot into
+		const WorldSnapshot&				get(std::size_t ticksAgo) const;	//0 is the latest
+		const WorldSnapshot&				oldest() const;
+
+		std::size_t							size() const;
+		bool								isEmpty() const;
+		void								clear();
+
+	private:
+		std::vector<WorldSnapshot>			slots_;
+		std::size_t							next_;
+		std::size_t							size_;
+	};
+}